@@ -2,10 +2,31 @@
  * Changed to use the Standard I/O library  9/13/82  FZ
  */
 #include <stdio.h>
+#include <stdlib.h>
 #include "acom.h"
 #include "obj.h"
 
 /*
+ * Version Z.9.  interlude() puts the symbols out in alphabetical order
+ *  rather than hash table order, since the table now grows.
+ *
+ * Version Z.8.  Added the -S switch, which reports the time each pass
+ *  takes and the counts putstats() (see a.misc.c) prints.  These used
+ *  to need a build with STATS defined.
+ *
+ * Version Z.7.  Added the -j switch.  main() goes on in a child process
+ *  for each source file once init() has set the tables up (see a.init.c).
+ *
+ * Version Z.6.  Added the -r switch.  Pass 1 is repeated, with symbols
+ *  taking new values, until the branches relax() sizes stop growing.
+ *
+ * Version Z.5.  Pass 2 now takes its lines from the journal pass 1 keeps
+ *  (see a.input.c), so macro calls, repeats and .input only push input
+ *  frames in pass 1.
+ *
+ * Version Z.4.  Added the -X switch, which writes the x.out file
+ *  directly (see a.xout.c) instead of leaving a .obj file for xcon.
+ *
  * Version Z.3, 4/7/83.  Added explicit fclose of LIST and OBJECT files,
  *  in case of error exit.
  *
@@ -37,9 +58,20 @@ static	char	ident[] = "@(#)a.ascom.c	3.6";
 
 extern	char	segflg;
 extern	char	oflag;
+extern	char	*jnbuf;
+extern	char	*jnptr;
 
 char putfile[15];
-char optfile[15];
+char optfile[64];
+
+char	*brtab;			/* for each branch, nonzero if long */
+exprval	*brloc;			/* where each branch was in the last pass */
+int	brct;			/* number of branches in brtab */
+int	brmax;			/* room in brtab */
+int	brnum;			/* number of the next branch in this pass */
+char	brchg;			/* set when a branch has grown this pass */
+
+int	sycmp();
 
 main(argc,argv) int argc; char *argv[]; {
 
@@ -48,7 +80,18 @@ struct	octab	*ocp;
 int	index;
 
 	init(argc,argv);
+	if(jobs) batch();  /* returns in a child, one per source file */
 	dopass();
+	if(brct) {  /* size the branches until they stop growing */
+		sizing = 1;
+		do {
+			brchg = 0;
+			clrdp2();
+			dopass();
+		} while(brchg);
+		sizing = 0;
+		clrdp2();
+	}
 	interlude();
 	pass2 = 1;
 	dopass();
@@ -58,13 +101,18 @@ int	index;
 		pgcheck();  fprintf(LIST,errfmt,errct,warnct);
 		if(xflag) putxref();
 	}
-	unlink("VM.TMP");
+	if(stats) putstats();
 	if(errct) {
+		if(jobs) fprintf(ERROR,"%s: ",srcfile);
 		fprintf(ERROR,errfmt,errct,warnct);
-		fclose(LIST);
-		fclose(OBJECT);
+		if(LIST) fclose(LIST);
+		if(OBJECT) fclose(OBJECT);
 		exit(1);
 	}
+	if(xoflag) {
+		xout();
+		exit(0);
+	}
 	argv[index = 0] = "xcon";
 	index++;
 	if (segflg)
@@ -127,23 +175,82 @@ struct	sytab	*syp;
 	if(label == 0) return(0);  /* no label */
 	xref(label,XRDEF);
 	syp = wfetch(label);
-	if(syp->sy_typ!=STVAR&&(pass2?syp->sy_atr&SADP2:syp->sy_typ!=STUND)) {
+	if(syp->sy_typ!=STVAR&&(pass2||sizing?syp->sy_atr&SADP2:
+	 syp->sy_typ!=STUND)) {
 		err('M');  syp->sy_atr |= SAMUD;
 		return(0);
 	}
 	if(syp->sy_typ == STUND) {  /* assign a type */
 		syp->sy_typ = typ;  syp->sy_rel = RBUND;
 	} else if(syp->sy_typ != typ) goto phaser;
-	if(syp->sy_rel==RBUND || syp->sy_typ==STVAR) {  /* assign a value */
-		syp->sy_val = val;  syp->sy_rel = rel;
+	if(syp->sy_rel==RBUND || syp->sy_typ==STVAR || sizing) {
+		syp->sy_val = val;  syp->sy_rel = rel;  /* assign a value */
 	} else if(syp->sy_val!=val || syp->sy_rel!=rel) goto phaser;
-	if(pass2) syp->sy_atr |= SADP2;
+	if(pass2 || sizing) syp->sy_atr |= SADP2;
 	return(syp);
 phaser:
 	err('P');
 	return(0);
 }
 
+/*
+ * brlong - Tells whether the next branch whose size the assembler picks
+ * (see relax() in as*.c) takes its long form.  The parameter says whether
+ * the short form reaches the target, as far as this pass can tell.  A
+ * branch that has grown stays long, so the sizing passes come to an end.
+ */
+brlong(fits) int fits; {
+
+	if(brnum >= brct) {  /* a new branch */
+		if(brct >= brmax) {
+			brmax = brmax ? 2*brmax : 256;
+			if((brtab = realloc(brtab,brmax)) == NULL ||
+			 (brloc = realloc(brloc,brmax*sizeof(exprval))) == NULL) {
+				fprintf(ERROR,"Out of memory\n");
+				exit(1);
+			}
+		}
+		brtab[brct++] = 0;
+	}
+	if(!fits && !brtab[brnum] && !pass2) {
+		brtab[brnum] = 1;
+		brchg = 1;
+	}
+	brloc[brnum] = curloc;
+	return(brtab[brnum++]);
+}
+
+/*
+ * brfrom - Returns where the next branch was in the last pass, or where
+ * it is now if it is new.  A target further on still has its address
+ * from the last pass, so relax() measures from there; measured from
+ * here, the growth of the branches in between would count against it.
+ */
+exprval
+brfrom() {
+
+	return(brnum<brct ? brloc[brnum] : curloc);
+}
+
+/*
+ * clrdp2 - Clears the defined-in-pass-2 marks before a pass that checks
+ * for multiple definitions by them.
+ */
+clrdp2() {
+
+struct	sytab	*syp;
+vmadr	p;
+uns	h;
+
+	for(h=0 ; h<syhsiz ; h++) {
+		for(p=syhtab[h] ; p ; p=syp->sy_lnk) {
+			syp = (struct sytab *)rfetch(p);
+			if(syp->sy_typ!=STKEY && syp->sy_atr&SADP2)
+				((struct sytab *)wfetch(p))->sy_atr &= ~SADP2;
+		}
+	}
+}
+
 /*
  * def1 - Copies one statement into a macro definition.
  */
@@ -210,17 +317,26 @@ delim() {
  */
 dopass() {
 
+long	t;
+
+	t = wtime();
+	if(!pass2 && !sizing) jnmode = JNREC;
+	else if(jnmode != JNOFF) {  /* replay the lines pass 1 read */
+		jnmode = JNPLAY;
+		jnptr = jnbuf;
+	}
 	if(include(srcfile) != 0) {
 		fprintf(ERROR,"Cannot open %s\n",srcfile);
 		exit(1);
 	}
-	condlev = curatr = curloc = cursec = deflev = mexct =
-	 rptlev = sectab[0].se_loc = truelev = 0;
+	brnum = condlev = curatr = curloc = cursec = deflev = mexct =
+	 rptlev = sectab[0].se_loc = stmct = truelev = 0;
 	curaln = minaln;
 	curext = 32;
 	reading = secct = 1;
 	label = sylook("__text");  newsec();	/* set the default section */
 	while(reading) {  /* process statements one at a time */
+		stmct++;
 		if(deflev > 0) {  /* defining a macro */
 			def1();
 		} else if(rptlev > 0) {  /* defining a repeat */
@@ -238,6 +354,12 @@ dopass() {
 	}
 	setsec(0);  /* update sectab info for last section */
 	while(toktyp != TKEOF) token();
+	if(stats) {
+		t = wtime() - t;
+		printf("%-12s%6ld.%03ld ms%8u statements\n",
+		 pass2 ? "Pass 2" : sizing ? "Sizing pass" : "Pass 1",
+		 t/1000,t%1000,stmct);
+	}
 }
 
 /*
@@ -262,6 +384,7 @@ emitb(value,reloc) uns value, reloc; {
 			*--relbot = objtop-objbuf;
 		}
 		oputb(value);  objbuf[5]++;
+		sectab[cursec].se_byt++;
 		/*
 		 * Output to the listing.
 		 */
@@ -328,7 +451,8 @@ interlude() {
 
 struct	sytab	*syp;
 vmadr	p;
-uns	h;
+vmadr	*syv;
+uns	h, i, n;
 uns	rel;
 char	type;
 
@@ -343,39 +467,61 @@ char	type;
 		oputb(sectab[rel].se_atr);
 		oputs(syp->sy_str);
 	}
+	/*
+	 * The symbols go out in alphabetical order, so the object file does
+	 * not depend on how the hash table happens to be laid out.
+	 */
+	if((syv = (vmadr *)malloc((symct+1)*sizeof *syv)) == NULL) {
+		fprintf(ERROR,"Out of memory for symbols\n");
+		exit(1);
+	}
+	n = 0;
+	for(h=0 ; h<syhsiz ; h++)
+		for(p=syhtab[h] ; p ; p=((struct sytab *)rfetch(p))->sy_lnk)
+			syv[n++] = p;
+	qsort(syv,n,sizeof *syv,sycmp);
 	rel = RBEXT;
-	for(h=0 ; h<1<<SHSHLOG ; h++) {
-		for(p=syhtab[h] ; p ; p=syp->sy_lnk) {
-			syp = (struct sytab *)rfetch(p);
-			if(syp->sy_typ==STKEY || syp->sy_typ==STSEC) continue;
-			if(syp->sy_atr&SAGLO || uext&&syp->sy_typ==STUND)
-				type = OBGLO;
-			else
-				type = OBLOC;
-			if(objtyp!=type || relbot-objtop<SYMSIZ+7) {
-				oflush();  objtyp = type;
-			}
-			if(syp->sy_typ == STUND) {
-				oputl(0L);
-				oputb(RBUND);
-				if(syp->sy_atr&SAGLO || uext) {
-					if(rel >= RBMSK) {
-						fprintf(ERROR,"Too many externals\n");
-						exit(1);
-					}
-					syp = (struct sytab *)wfetch(p);
-					syp->sy_typ = STLAB;
-					syp->sy_atr |= SAGLO;
-					syp->sy_val = 0;
-					syp->sy_rel = rel++;
+	for(i=0 ; i<n ; i++) {
+		p = syv[i];
+		syp = (struct sytab *)rfetch(p);
+		if(syp->sy_typ==STKEY || syp->sy_typ==STSEC) continue;
+		if(syp->sy_atr&SAGLO || uext&&syp->sy_typ==STUND)
+			type = OBGLO;
+		else
+			type = OBLOC;
+		if(objtyp!=type || relbot-objtop<SYMSIZ+7) {
+			oflush();  objtyp = type;
+		}
+		if(syp->sy_typ == STUND) {
+			oputl(0L);
+			oputb(RBUND);
+			if(syp->sy_atr&SAGLO || uext) {
+				if(rel >= RBMSK) {
+					fprintf(ERROR,"Too many externals\n");
+					exit(1);
 				}
-			} else {
-				oputl((long)syp->sy_val);
-				oputb(syp->sy_rel);
+				syp = (struct sytab *)wfetch(p);
+				syp->sy_typ = STLAB;
+				syp->sy_atr |= SAGLO;
+				syp->sy_val = 0;
+				syp->sy_rel = rel++;
 			}
-			oputs(syp->sy_str);
+		} else {
+			oputl((long)syp->sy_val);
+			oputb(syp->sy_rel);
 		}
+		oputs(syp->sy_str);
 	}
+	free(syv);
+}
+
+/*
+ * sycmp - Compares two symbols by name, for qsort in interlude().
+ */
+sycmp(a,b) vmadr *a, *b; {
+
+	return(symcmp(((struct sytab *)rfetch(*a))->sy_str,
+	 ((struct sytab *)rfetch(*b))->sy_str));
 }
 
 /*
@@ -488,6 +634,10 @@ char	nbuf[6];
 	}
 	while(ch != '\n') scanc();
 	toktyp = TKEOL;
+	if(jnmode == JNPLAY) {  /* the expansion is in the journal */
+		insp = (char *)newfp;
+		return;
+	}
 	/*
 	 * Copy the macro body onto the input stack.
 	 */
@@ -527,10 +677,10 @@ oflush() {
 char	*op;
 
 	if(objtyp) {
-		fputc(objtyp,OBJECT);
-		fputc(OBJSIZ-(relbot-objtop),OBJECT);
-		for(op=objbuf ; op<objtop ; op++) fputc(*op,OBJECT);
-		for(op=relbot ; op<&objbuf[OBJSIZ] ; op++) fputc(*op,OBJECT);
+		oputc(objtyp);
+		oputc(OBJSIZ-(relbot-objtop));
+		for(op=objbuf ; op<objtop ; op++) oputc(*op);
+		for(op=relbot ; op<&objbuf[OBJSIZ] ; op++) oputc(*op);
 	}
 	objtop = objbuf;  relbot = &objbuf[OBJSIZ];  objtyp = 0;
 }
@@ -609,6 +759,11 @@ char	rch;
 		unscanc();  token();
 	} else {  /* finish off the repeat definition and start the repeat */
 		*wfetch(vmalloc(1)) = '\0';
+		if(jnmode == JNPLAY) {  /* the repeats are in the journal */
+			virtop = rptstr;
+			skipeol();
+			return;
+		}
 		newfp = pushin();
 		newfp->in_typ = INRPT;
 		newfp->in_rpt = rptct;
@@ -18,6 +18,8 @@
  * Parameters.
  */
 #define	BLKLOG	9		/* log base 2 of disk block size */
+#define	CHKLOG	15		/* log base 2 of virtual memory chunk size */
+#define	HISTSZ	8		/* buckets in the -S chain length histograms */
 #define	IISIZ	30		/* size of parse stack in frames */
 #define	INSIZ	4096		/* size of input stack in bytes */
 #define	LLERR	3		/* length of error field in listing line */
@@ -26,14 +28,14 @@
 #define	LLPP	58		/* listing lines/page (must be less than 64) */
 #define	LLSEQ	5		/* length of sequence field in listing line */
 #define	OBJSIZ	255		/* maximum object block length */
-#define	OHSHLOG	6		/* log base 2 of opcode hash table size */
+#define	OHSHLOG	9		/* log base 2 of first opcode hash table size */
 
 #ifndef PDDIR			/* following define overridable in cc line */
 #define	PDDIR	"/usr/lib"	/* directory containing the predef file */
 #endif
 
 #define	SECSIZ	255		/* maximum number of sections including abs */
-#define	SHSHLOG	9		/* log base 2 of symbol hash table size */
+#define	SHSHLOG	9		/* log base 2 of first symbol hash table size */
 #define	SLINSIZ	128		/* maximum source line length */
 #define	STRSIZ	128		/* maximum string length */
 #define	SYMSIZ	8		/* maximum symbol length */
@@ -89,6 +91,17 @@
 #define	INMAC	2		/* macro expansion */
 #define	INRPT	3		/* repeat */
 #define	INARG	4		/* macro argument */
+/*
+ * Journal modes (in jnmode) and journal record types.
+ */
+#define	JNOFF	0		/* no journal */
+#define	JNREC	1		/* pass 1 is recording its input */
+#define	JNPLAY	2		/* pass 2 is replaying it */
+#define	JNLINE	1		/* source line */
+#define	JNEOF	2		/* end of input */
+#define	JNCOND	3		/* outcome of a .if */
+#define	JNINC	4		/* outcome of an include */
+#define	JNRPT	5		/* count of a .repeat */
 /*
  * Operand classes.
  */
@@ -156,10 +169,6 @@
 #define	TKEOL	102		/* end of line */
 #define	TKSPC	103		/* white space */
 #define	TKERR	127		/* erroneous token */
-/*
- * Virtual memory buffer flags (in vm_flg).
- */
-#define	VMDIR	01		/* dirty bit */
 /*
  * Cross reference masks (in xr_pl).
  */
@@ -239,6 +248,7 @@ struct	section {		/* section table entry */
 	char	se_aln;			/* alignment */
 	char	se_ext;			/* extent */
 	char	se_atr;			/* attributes */
+	long	se_byt;			/* bytes emitted, for -S */
 };
 struct	sytab {			/* symbol table entry */
 	vmadr	sy_lnk;			/* link to next entry in hash chain */
@@ -249,12 +259,6 @@ struct	sytab {			/* symbol table entry */
 	char	sy_atr;			/* attributes of symbol */
 	char	sy_str[SYMSIZ];		/* symbol mnemonic string */
 };
-struct	vmbuf {			/* virtual memory buffer */
-	struct	vmbuf	*vm_lnk;	/* lru link to next buffer */
-	short	vm_blk;			/* disk block number */
-	short	vm_flg;			/* flags */
-	char	vm_mem[1<<BLKLOG];	/* disk block data storage */
-};
 struct	xref {			/* cross reference entry */
 	vmadr	xr_lnk;			/* circular link to next entry */
 	int	xr_pl;			/* page and line number */
@@ -263,10 +267,12 @@ struct	xref {			/* cross reference entry */
  * Global variable declarations.
  */
 char		argchr;		/* macro argument designator character */
+uns		ashct;		/* number of symbol lookaside hits */
 struct	aside	*ashead;	/* symbol lookaside lru chain head */
 struct	aside	aspool[];	/* pool of symbol lookaside entries */
 int		ch;		/* current character from scanc */
 struct	chent	chtab[];	/* single-character token table */
+uns		chnct;		/* total sytab links followed */
 uns		condlev;	/* nesting level of conditionals */
 char		condlst;	/* flag enabling listing of skipped code */
 uns		curaln;		/* alignment for current section */
@@ -283,6 +289,7 @@ uns		deflev;		/* macro definition nesting level */
 char		eflg;		/* expression error flag */
 extern	char	oflag;		/* Flag to Make Labled output file */
 extern	char	segflg;		/* Flag to Make Segmented output file */
+extern	char	xoflag;		/* Flag to Make x.out file directly */
 uns		errct;		/* error count */
 char		escchr;		/* escape character */
 int		extoff;		/* offset of source extension in program name */
@@ -292,9 +299,13 @@ int		iilsym;		/* new left part symbol */
 struct	psframe	iips[];		/* parsing stack */
 struct	psframe	*iipsp;		/* parsing stack pointer */
 struct	psframe	*iipspl;	/* parsing left end pointer */
+uns		incct;		/* number of .input files in pass 1 */
+uns		incdep;		/* deepest .input nesting in pass 1 */
 struct	input	*infp;		/* input frame pointer */
 char		*insp;		/* input stack pointer */
 int		instk[];	/* input stack */
+char		jnmode;		/* what the journal is being used for */
+int		jobs;		/* number of files assembled at once (-j) */
 vmadr		label;		/* sytab pointer for statement label */
 char		labstr[];	/* label string */
 char		lbrchr;		/* left brace character for macro args */
@@ -317,7 +328,9 @@ uns		nxtsec;		/* next section for text output */
 char		objbuf[];	/* object block construction area */
 char		*objtop;	/* top of text info in objbuf */
 char		objtyp;		/* object block type being built */
-struct	octab	*ochtab[];	/* opcode hash table */
+struct	octab	**ochtab;	/* opcode hash table */
+uns		ochsiz;		/* number of buckets in ochtab */
+uns		occt;		/* number of opcodes in ochtab */
 struct	octab	*opcode;	/* octab pointer for statement opcode */
 char		opcstr[];	/* opcode string */
 struct	operand	optab[];	/* instruction operands description */
@@ -333,6 +346,7 @@ int		ptab[];		/* parsing action table */
 char		rbrchr;		/* right brace character for macro args */
 char		reading;	/* flag indicating we are reading input */
 char		*relbot;	/* bottom of relocation info in objbuf */
+char		rflag;		/* flag letting the assembler size branches */
 uns		rmarg;		/* listing right margin column */
 char		rptct;		/* repeat count for current repeat def */
 uns		rptlev;		/* repeat definition nesting level */
@@ -343,10 +357,17 @@ char		*scanpt;	/* pointer to next character in sline */
 char		scntab[];	/* symbol scanning table */
 uns		secct;		/* number of sections defined */
 struct	section	sectab[];	/* section table */
+char		sizing;		/* flag indicating a branch sizing pass */
 int		semtab[];	/* semantic action table */
 char		sline[];	/* buffer holding current source line */
 char		*srcfile;	/* source file name pointer */
-vmadr		syhtab[];	/* symbol hash table */
+char		stats;		/* flag enabling statistics (-S) */
+uns		stmct;		/* statements processed this pass */
+vmadr		*syhtab;	/* symbol hash table */
+uns		syhsiz;		/* number of buckets in syhtab */
+uns		sylct;		/* number of calls to sylook */
+uns		symct;		/* number of symbols */
+char		symflg;		/* symbol or $ in expression flag */
 char		titl1[];	/* first title line */
 char		titl2[];	/* second title line */
 char		tokstr[];	/* string from token scanner */
@@ -356,26 +377,14 @@ uns		truelev;	/* true conditional nesting level */
 char		uext;		/* flag turning undef. syms into externals */
 char		uflg;		/* undefined symbol in expression flag */
 vmadr		virtop;		/* first unused vm location */
-int		vmfd;		/* virtual memory file descriptor */
-struct	vmbuf	*vmhead;	/* head of vm lru chain */
-struct	vmbuf	vmpool[];	/* pool of virtual memory buffers */
+uns		vmgct;		/* number of vm accesses */
 uns		warnct;		/* warning count */
 char		xflag;		/* flag enabling cross referencing */
-
-#ifdef	STATS
-uns		ashct;		/* number of symbol lookaside hits */
-uns		chnct;		/* total sytab links followed */
-char		stats;		/* flag enabling statistics */
-uns		sylct;		/* number of calls to sylook */
-uns		symct;		/* number of symbols */
-uns		vmgct;		/* number of vm accesses */
-uns		vmrct;		/* number of vm disk reads */
-uns		vmwct;		/* number of vm disk writes */
-#endif
 /*
  * Function declarations.
  */
 struct	sytab	*assign();
+char		*getadr();
 uns		hash();
 struct	octab	*oclook();
 struct	input	*pushin();
@@ -391,3 +400,4 @@ int		openb();
 int		creatb();
 FILE		*_fopen();
 void		chain();
+long		wtime();
@@ -6,6 +6,11 @@
 #include "obj.h"
 
 /*
+ * Version Z.2.  .input counts the files it reads for -S.
+ *
+ * Version Z.1.  .if, .repeat and .exit go along with the journal (see
+ *  a.input.c) in pass 2.
+ *
  * Version 3.4, 8/27/82.  Changed this routine to dircom, and moved
  * direc to the as*.c files.
  *
@@ -13,7 +18,7 @@
  *
  * Version 3.2, 5/22/82.  Fixed listing control.
  */
-static	char	ident[] = "@(#)a.direc.c	3.4";
+static	char	ident[] = "@(#)a.direc.c	Z.1";
 
 /*
  * dircom - Performs the assembler directives common to all versions.
@@ -25,6 +30,7 @@ vmadr	sym;
 exprval	l;
 int	i;
 char	cond;
+struct	input	*ip;
 char	*sp;
 char	llsave;
 
@@ -90,7 +96,7 @@ char	llsave;
 		if(label) {
 			syp = (struct sytab *)rfetch(label);
 			if(syp->sy_typ==STSEC &&
-			 (!pass2||syp->sy_atr&SADP2)) {  /* old section */
+			 (!(pass2||sizing)||syp->sy_atr&SADP2)) {  /* old section */
 				setsec(syp->sy_rel);
 			} else {  /* start a new common section */
 				newsec();
@@ -139,8 +145,9 @@ char	llsave;
 		break;
 
 	case ADEXIT:	/* .exit */
-		if(infp && (infp->in_typ==INMAC||infp->in_typ==INRPT)) popin();
-		else err('O');
+		if(infp && (infp->in_typ==INMAC||infp->in_typ==INRPT)) {
+			if(jnmode != JNPLAY) popin();
+		} else err('O');
 		break;
 
 	case ADGLOB:	/* .global */
@@ -163,12 +170,23 @@ char	llsave;
 		if(curop.op_rel) {
 			cond = 0;  err('E');
 		} else cond = curop.op_val!=0;
+		if((uflg || rflag&&symflg) && jnmode==JNREC) jnmode = JNOFF;
+		if(jnval(JNCOND,cond) != cond) {  /* not as in pass 1 */
+			err('P');  cond = !cond;
+		}
 		if(cond) truelev++;
 		break;
 
 	case ADINPUT:	/* .input */
 		if(toktyp!=TKSPC || token()!=TKSTR) goto synerr;
 		if(include(tokstr) == -1) err('E');
+		else if(!pass2 && !sizing) {  /* for -S */
+			incct++;
+			i = 0;
+			for(ip=infp ; ip ; ip=ip->in_ofp)
+				if(ip->in_typ == INFILE) i++;
+			if(i-1 > incdep) incdep = i-1;
+		}
 		token();
 		break;
 
@@ -238,13 +256,15 @@ char	llsave;
 		rptstr = virtop;
 		if(curop.op_rel!=RBABS || curop.op_val>255L) err('E');
 		else rptct = curop.op_val>=0?curop.op_val:0;
+		if((uflg || rflag&&symflg) && jnmode==JNREC) jnmode = JNOFF;
+		if((char)jnval(JNRPT,rptct) != rptct) err('P');
 		break;
 
 	case ADSECT:	/* .sect */
 		if(label) {
 			syp = (struct sytab *)rfetch(label);
 			if(syp->sy_typ==STSEC &&
-			 (!pass2||syp->sy_atr&SADP2)) {  /* old section */
+			 (!(pass2||sizing)||syp->sy_atr&SADP2)) {  /* old section */
 				setsec(syp->sy_rel);
 			} else {  /* start a new section */
 				newsec();
@@ -80,21 +80,6 @@ char		*scanpt = &sline[0];
 uns		secct = 1;
 /*		semtab	is initialized in as*gram.c */
 vmadr		virtop = 2;
-struct	vmbuf	*vmhead = &vmpool[0];
-struct	vmbuf	vmpool[] = {
-	{ &vmpool[1], -1 },
-	{ &vmpool[2], -1 },
-	{ &vmpool[3], -1 },
-	{ &vmpool[4], -1 },
-	{ &vmpool[5], -1 },
-	{ &vmpool[6], -1 },
-	{ &vmpool[7], -1 },
-	{ &vmpool[8], -1 },
-	{ &vmpool[9], -1 },
-	{ &vmpool[10], -1 },
-	{ &vmpool[11], -1 },
-	{ 0, -1}
-};
 
 /*
  * The following variables all have initial values of zero.  We need
@@ -102,7 +87,9 @@ struct	vmbuf	vmpool[] = {
  */
 #ifdef NOBSS
 
+uns		ashct = 0;
 int		ch = 0;
+uns		chnct = 0;
 uns		condlev = 0;
 uns		curaln = 0;
 uns		curatr = 0;
@@ -119,8 +106,12 @@ struct	psframe	iilexeme = { 0 };
 int		iilset = 0;
 int		iilsym = 0;
 struct	psframe	iips[IISIZ] = {0};
+uns		incct = 0;
+uns		incdep = 0;
 struct	input	*infp = 0;
 int		instk[INSIZ] = {0};
+char		jnmode = 0;
+int		jobs = 0;
 vmadr		label = 0;
 char		labstr[SYMSIZ+1] = {0};
 char		lflag = 0;
@@ -136,7 +127,7 @@ exprval		nxtloc = 0;
 uns		nxtsec = 0;
 char		objbuf[OBJSIZ] = {0};
 char		objtyp = 0;
-struct	octab	*ochtab[1<<OHSHLOG] = {0};
+/*		ochtab, ochsiz and occt are initialized in as*pd.c */
 struct	octab	*opcode = 0;
 char		opcstr[SYMSIZ+1] = {0};
 uns		pagect = 0;
@@ -145,15 +136,23 @@ char		pass2 = 0;
 char		pflag = 0;
 int		prevsem = 0;
 char		*prname = 0;
+char		rflag = 0;
 char		rptct = 0;
 uns		rptlev = 0;
 vmadr		rptstr = 0;
 int		savlen = 0;
 char		savstr[STRSIZ+1] = {0};
 struct	section	sectab[SECSIZ] = {0};
+char		sizing = 0;
 char		sline[SLINSIZ+2] = {0};
 char		*srcfile = 0;
-vmadr		syhtab[1<<SHSHLOG] = {0};
+char		stats = 0;
+uns		stmct = 0;
+vmadr		*syhtab = 0;
+uns		syhsiz = 0;
+uns		sylct = 0;
+uns		symct = 0;
+char		symflg = 0;
 char		titl1[TITSIZ+1] = {0};
 char		titl2[TITSIZ+1] = {0};
 char		tokstr[STRSIZ+1] = {0};
@@ -162,19 +161,8 @@ exprval		tokval = 0;
 uns		truelev = 0;
 char		uext = 0;
 char		uflg = 0;
-int		vmfd = 0;
+uns		vmgct = 0;
 uns		warnct = 0;
 char		xflag = 0;
 
-#ifdef STATS
-uns		ashct = 0;
-uns		chnct = 0;
-char		stats = 0;
-uns		sylct = 0;
-uns		symct = 0;
-uns		vmgct = 0;
-uns		vmrct = 0;
-uns		vmwct = 0;
-#endif
-
 #endif
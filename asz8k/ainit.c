@@ -1,12 +1,19 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
 /*
  * Changed to use the Standard I/O library  9/13/82  FZ
  */
 #include "acom.h"
 
 /*
+ * Version Z.3.  Added the -S switch.
+ *
+ * Version Z.2.  Added the -j switch, which assembles several source
+ *  files at once.  The per-file part of init() is now setup().
+ *
  * Version Z.1, 4/5/83.  Added external declarations of segflg and oflag.
  */
 
@@ -38,25 +45,32 @@ getdat() {
 
 extern	char	putfile[];
 extern	char	optfile[];
+
+char	**srcv;			/* the source file names */
+int	srcn;			/* number of them */
+
 /*
  * init - Performs assembler initialization.
  */
 init(argc,argv) int argc; char *argv[]; {
 
-char	**av;
 char	*ap;
-char	*ep;
-char	*sp;
-char	fname[15];
-int	fd;
-FILE	*newfile();
 
 	getdat();
 	prname = "asz8k";
+	if((srcv = (char **)malloc(argc * sizeof *srcv)) == NULL) {
+		fprintf(ERROR,"Out of memory\n");
+		exit(1);
+	}
 	while((ap = *++argv) != 0) {  /* read command line arguments */
 		if(*ap == '-') {  /* switches */
 			while(*++ap) switch(*ap) {
 
+			case 'j':
+				if(*++argv == NULL || (jobs = atoi(*argv)) < 1)
+					usage();
+				break;
+
 			case 'l':
 				lflag = 1;
 				break;
@@ -73,10 +87,18 @@ FILE	*newfile();
 				pflag = 1;
 				break;
 
+			case 'r':
+				rflag = 1;
+				break;
+
 			case 's':
 				segflg = 1;
 				break;
 
+			case 'S':
+				stats = 1;
+				break;
+
 			case 'u':
 				uext = 1;
 				break;
@@ -85,17 +107,76 @@ FILE	*newfile();
 				xflag = lflag = 1;
 				break;
 
+			case 'X':
+				xoflag = 1;
+				break;
+
 			default:
 				printf("error case\n");
 				usage();
 
 			}
-		} else {  /* file name */
-			if(srcfile) {printf("srcfile != 0\n"); usage();}
-			srcfile = ap;
+		} else  /* file name */
+			srcv[srcn++] = ap;
+	}
+	if(!srcn) {printf("no srcfile\n"); usage();}
+	if(srcn>1 && !jobs) {printf("srcfile != 0\n"); usage();}
+	if(jobs && oflag) {printf("-o with -j\n"); usage();}
+	if(!jobs) setup(srcv[0]);
+	vinit();
+	predef();
+}
+
+/*
+ * batch - Assembles each source file in a process of its own, with up
+ * to jobs of them running at once.  The children are forked after
+ * init() has built the tables, so they share them, and batch() returns
+ * in each child with its source file set up.  The parent waits for them
+ * all and exits, unsuccessfully if any of them failed.
+ */
+batch() {
+
+int	i, n, st, bad;
+int	pid;
+
+	n = bad = 0;
+	for(i=0 ; i<srcn ; i++) {
+		if(n == jobs) {
+			wait(&st);
+			if(st) bad = 1;
+			n--;
+		}
+		fflush(stdout);
+		if((pid = fork()) == -1) {
+			fprintf(ERROR,"Cannot fork\n");
+			exit(1);
+		}
+		if(pid == 0) {
+			setup(srcv[i]);
+			return;
 		}
+		n++;
 	}
-	if(!srcfile) {printf("no srcfile\n"); usage();}
+	while(n--) {
+		wait(&st);
+		if(st) bad = 1;
+	}
+	exit(bad);
+}
+
+/*
+ * setup - Checks the name of a source file and creates the object and
+ * listing files for it.
+ */
+setup(name) char *name; {
+
+char	*ep;
+char	*sp;
+char	fname[15];
+int	fd;
+FILE	*newfile();
+
+	srcfile = name;
 	if((sp = strrchr(srcfile,'/')) == 0) sp = srcfile; else sp++;
 	if(strlen(sp) > 14) sp[14] = '\0';
 	strcpy(titl1,srcfile);
@@ -119,13 +200,16 @@ FILE	*newfile();
 		fprintf(ERROR,"Cannot open %s\n",srcfile);
 		exit(1);
 	}
-	strcpy(ep,"obj");  OBJECT = newfile(fname,BinFile);
+	if(jobs && xoflag) {  /* each x.out is named after its source */
+		oflag = 1;
+		strcpy(optfile,fname);
+		strcpy(optfile+(ep-fname),"out");
+	}
+	strcpy(ep,"obj");  if(!xoflag) OBJECT = newfile(fname,BinFile);
 	strcpy(putfile,fname);
 	if(lflag) {
 		strcpy(ep,"lst");  LIST = newfile(fname,AscFile);
 	}
-	vinit();
-	predef();
 }
 
 /*
@@ -159,7 +243,7 @@ preget(typ) int typ; {
  */
 usage() {
 
-	fprintf(ERROR,"Usage:  asz8k [-o outfile] [-luxs] file.{8kn|8ks|s}\n");
+	fprintf(ERROR,"Usage:  asz8k [-o outfile] [-j jobs] [-lurxsSX] file.{8kn|8ks|s} ...\n");
 	exit(1);
 }
 
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 /*
@@ -8,10 +9,29 @@
 #include "acom.h"
 
 /*
+ * Version Z.1.  Added the journal, so that pass 2 replays the lines pass 1
+ *  read instead of reading the files and expanding the macros again.
+ *
  * Version 3.2, 7/5/82.  Performance enhancements.
  */
 
-static	char	ident[] = "@(#)a.input.c	3.2";
+static	char	ident[] = "@(#)a.input.c	Z.1";
+
+/*
+ * The journal holds every line agetline() delivers in pass 1, along with
+ * the listing state that goes with it and the outcome of each .if,
+ * .repeat and include.  Pass 2 takes its lines from here; the frames it
+ * would push for macros, repeats and includes are never filled, since
+ * the lines they would give are already in the journal.  Pass 1 stops
+ * recording (and pass 2 reads the source again) if a .if or .repeat
+ * depends on a symbol that is not yet defined, as pass 2 might then
+ * take a different path through the source.
+ */
+char	*jnbuf;			/* the journal */
+long	jnlen;			/* bytes in jnbuf */
+long	jnmax;			/* room in jnbuf */
+char	*jnptr;			/* next byte to replay */
+struct	input	jnfr;		/* stands in for the input frame in pass 2 */
 
 /*
  * fillin - Processes the end of an input stack frame.
@@ -56,7 +76,10 @@ include(file) char *file; {
 
 int	fd;
 
-	if((fd = opena(file,0)) == -1) return(-1);
+	if(jnmode == JNPLAY) return(jnval(JNINC,0));
+	fd = opena(file,0);
+	jnval(JNINC,fd==-1 ? -1 : 0);
+	if(fd == -1) return(-1);
 	infp = pushin();
 	insp += 1<<BLKLOG;  iovck();
 	infp->in_typ = INFILE;
@@ -77,6 +100,107 @@ iovck() {
 	}
 }
 
+/*
+ * jnb - Puts a byte into the journal.
+ */
+jnb(c) int c; {
+
+	if(jnlen >= jnmax) {
+		jnmax = jnmax ? 2*jnmax : 16384;
+		if((jnbuf = realloc(jnbuf,jnmax)) == NULL) {
+			fprintf(ERROR,"Out of memory\n");
+			exit(1);
+		}
+	}
+	jnbuf[jnlen++] = c;
+}
+
+/*
+ * jnget - Replays the next line from the journal into sline and the
+ * listing buffer.  Returns 0 at the end of the input.
+ */
+jnget() {
+
+reg	char	*p;
+reg	char	*q;
+reg	char	*r;
+int	n;
+
+	p = jnptr;
+	if(p>=jnbuf+jnlen || *p==JNEOF) {
+		jnptr = p+1;
+		infp = 0;
+		sline[0] = -1;
+		sline[1] = '\0';
+		return(0);
+	}
+	if(*p++ != JNLINE) jnstep();
+	if(*p++) linect = 0;  /* page eject */
+	curlst = *p++ & 0377;
+	jnfr.in_lst = *p++;
+	jnfr.in_typ = *p++;
+	infp = &jnfr;
+	q = llseq;
+	while(*q++ = *p++) ;
+	n = (*p&0377) | (p[1]&0377)<<8;  p += 2;
+	for(q=sline,r=llsrc ; n-- > 0 ; ) *q++ = *r++ = *p++;
+	*q = *r = '\0';
+	jnptr = p;
+	return(1);
+}
+
+/*
+ * jnput - Records the line agetline() has just read in the journal.  The
+ * parameter is nonzero if the line was preceded by a page eject.
+ */
+jnput(ff) int ff; {
+
+reg	char	*p;
+int	n;
+
+	jnb(JNLINE);
+	jnb(ff);
+	jnb(curlst);
+	jnb(infp->in_lst);
+	jnb(infp->in_typ);
+	p = llseq;
+	do jnb(*p); while(*p++);
+	for(p=sline ; *p ; p++) ;
+	n = p-sline;
+	jnb(n);  jnb(n>>8);
+	for(p=sline ; n-- > 0 ; p++) jnb(*p);
+}
+
+/*
+ * jnstep - Complains that pass 2 has not asked for what pass 1 recorded.
+ */
+jnstep() {
+
+	fprintf(ERROR,"Pass 2 out of step with pass 1\n");
+	exit(1);
+}
+
+/*
+ * jnval - Records the value of an outcome in pass 1, and returns the
+ * recorded one in pass 2.  Otherwise it returns the value it is given.
+ */
+jnval(typ,val) int typ, val; {
+
+	switch(jnmode) {
+
+	case JNREC:
+		jnb(typ);  jnb(val);
+		break;
+
+	case JNPLAY:
+		if(*jnptr++ != typ) jnstep();
+		val = *jnptr++;
+		break;
+
+	}
+	return(val);
+}
+
 /*
  * macarg - Pushes a macro argument frame on the input stack.  The parameter
  * is the argument designator.
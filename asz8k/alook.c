@@ -1,10 +1,14 @@
 #include <stdio.h>
+#include <stdlib.h>
 /*
  * Changed to use the Standard I/O library  9/13/82  FZ
  */
 #include "acom.h"
 
 /*
+ * Version Z.1.  The symbol and opcode hash tables double in size as
+ *  they fill, and hash() is FNV-1a instead of shift-and-add.
+ *
  * Version 3.2, 8/19/82.  Added initialization of the sy_val field
  * when adding a new symbol to the symbol table.  It sometimes
  * came up nonzero, giving undefined externals nonzero values in
@@ -24,7 +28,8 @@ struct	octab	*p, *q, *r;
 uns	h;
 int	cmp;
 
-	h = hash(s)>>(16-OHSHLOG)&(1<<OHSHLOG)-1;
+	if(occt >= ochsiz) ochgrow();
+	h = hash(s)&ochsiz-1;
 	p = 0;
 	q = ochtab[h];
 	while(q && (cmp=symcmp(s,q->oc_str))>0) {  /* follow hash chain */
@@ -35,6 +40,7 @@ int	cmp;
 	/*
 	 * Add a new entry to the table.
 	 */
+	occt++;
 	r = (struct octab *)palloc(sizeof(struct octab));
 	symcpy(r->oc_str,s);
 	r->oc_typ = 0;
@@ -44,17 +50,48 @@ int	cmp;
 }
 
 /*
- * hash - Given a string, computes a partial hashing function of the string,
- * and returns its value.
+ * ochgrow - Doubles the size of the opcode hash table.  Each chain splits
+ * into two, in the same order, so the chains stay sorted.
+ */
+ochgrow() {
+
+static	char	alloc;		/* set once ochtab is ours to free */
+struct	octab	**t, **tl[2], *p, *q;
+uns	h, i;
+
+	if((t = (struct octab **)calloc(2*ochsiz,sizeof *t)) == NULL) {
+		fprintf(ERROR,"Out of memory for opcodes\n");
+		exit(1);
+	}
+	for(h=0 ; h<ochsiz ; h++) {
+		tl[0] = &t[h];  tl[1] = &t[h+ochsiz];
+		for(p=ochtab[h] ; p ; p=q) {
+			q = p->oc_lnk;
+			i = (hash(p->oc_str)&ochsiz) != 0;
+			p->oc_lnk = 0;
+			*tl[i] = p;  tl[i] = &p->oc_lnk;
+		}
+	}
+	if(alloc) free(ochtab);
+	ochtab = t;  ochsiz *= 2;  alloc = 1;
+}
+
+/*
+ * hash - Given a string, computes a hashing function of its first SYMSIZ
+ * characters (FNV-1a, with the high half folded into the low), and
+ * returns its value.  The low bits pick the bucket in the hash tables,
+ * and they have to differ for names like L123 and L124.
  */
 uns
 hash(s) char *s; {
 
-uns	h;
+reg	unsigned long h;
+reg	int	i;
 
-	h = 0;
-	while(*s) h = (h<<1)+*s++;
-	return(h*40143);
+	h = 2166136261L;
+	for(i=0 ; i<SYMSIZ && s[i] ; i++)
+		h = (h^s[i]&0377)*16777619L & 0xffffffffL;
+	return(h^h>>16);
 }
 
 /*
@@ -71,9 +108,8 @@ struct	sytab	*qp, *rp;
 uns	h;
 int	cmp;
 
-#ifdef	STATS
+	if(symct >= syhsiz) syhgrow();
 	sylct++;
-#endif
 	/*
 	 * Check the lookaside table to see if the symbol is in it.
 	 */
@@ -87,9 +123,7 @@ int	cmp;
 	 */
 	*lpt = apt->as_lnk;  apt->as_lnk = ashead;  ashead = apt;
 	if(cmp == 0) {  /* hit */
-#ifdef	STATS
 		ashct++;
-#endif
 		return(apt->as_sym);
 	}
 	/*
@@ -97,23 +131,19 @@ int	cmp;
 	 * the customary manner.
 	 */
 	symcpy(ashead->as_str,s);  /* update lookaside table */
-	h = hash(s)>>(16-SHSHLOG)&(1<<SHSHLOG)-1;
+	h = hash(s)&syhsiz-1;
 	p = 0;
 	q = syhtab[h];
 	while(q && (cmp=symcmp(s,(qp=(struct sytab *)rfetch(q))->sy_str))>0) {
 		p = q;
 		q = qp->sy_lnk;
-#ifdef	STATS
 		chnct++;
-#endif
 	}
 	if(q && cmp==0) return(ashead->as_sym = q);  /* found */
 	/*
 	 * Add a new entry to the table.
 	 */
-#ifdef	STATS
 	symct++;
-#endif
 	if((uns)virtop&01) virtop++;  /* force integer alignment */
 	rp = (struct sytab *)wfetch(r=vmalloc(sizeof(struct sytab)));
 	symcpy(rp->sy_str,s);
@@ -122,3 +152,32 @@ int	cmp;
 	if(p) ((struct sytab *)wfetch(p))->sy_lnk = r; else syhtab[h] = r;
 	return(ashead->as_sym = r);
 }
+
+/*
+ * syhgrow - Doubles the size of the symbol hash table, or makes it in
+ * the first place.  Like ochgrow(), it keeps the chains sorted.
+ */
+syhgrow() {
+
+vmadr	*t, *tl[2], p, q;
+struct	sytab	*syp;
+uns	h, i, n;
+
+	n = syhsiz ? 2*syhsiz : 1<<SHSHLOG;
+	if((t = (vmadr *)calloc(n,sizeof *t)) == NULL) {
+		fprintf(ERROR,"Out of memory for symbols\n");
+		exit(1);
+	}
+	for(h=0 ; h<syhsiz ; h++) {
+		tl[0] = &t[h];  tl[1] = &t[h+syhsiz];
+		for(p=syhtab[h] ; p ; p=q) {
+			syp = (struct sytab *)wfetch(p);
+			q = syp->sy_lnk;
+			i = (hash(syp->sy_str)&syhsiz) != 0;
+			syp->sy_lnk = 0;
+			*tl[i] = p;  tl[i] = &syp->sy_lnk;
+		}
+	}
+	free(syhtab);
+	syhtab = t;  syhsiz = n;
+}
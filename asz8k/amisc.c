@@ -7,6 +7,8 @@
 #include "acom.h"
 
 /*
+ * Version Z.1.  Added putstats() for -S.
+ *
  * Version 3.3, 7/5/82.  Added hooks for profiling and performance
  * enhancements.
  *
@@ -40,10 +42,17 @@ reg	struct	input	*rinfp;
 reg	int	ch;
 reg	char	*slp;
 reg	char	*llp;
+char	ff;
 
 	scanpt = slp = sline;  llp = llsrc;
+	if(jnmode == JNPLAY) {  /* pass 1 has read it already */
+		if(jnget()) goto list;
+		return;
+	}
+	ff = 0;
 	for( ; ; ) {
 		if((rinfp = infp) == 0) {  /* end of file */
+			if(jnmode == JNREC) jnb(JNEOF);
 			sline[0] = -1;
 			sline[1] = '\0';
 			return;
@@ -60,14 +69,17 @@ reg	char	*llp;
 		ch &= 0177;
 		if(ch == '\n')  /* we have a line */
 			break;
-		if(ch == '\f') linect = 0;  /* page eject */
-		else if(slp < &sline[SLINSIZ]) *slp++ = *llp++ = ch;
+		if(ch == '\f') {  /* page eject */
+			linect = 0;  ff = 1;
+		} else if(slp < &sline[SLINSIZ]) *slp++ = *llp++ = ch;
 	}
 	*slp++ = *llp++ = '\n';  *slp = *llp = '\0';
 	rinfp->in_seq++;
 	if(rinfp == (struct input *)instk)
 		sprintf(llseq," %4d",rinfp->in_seq);
 	else sprintf(llseq,"+%4d",rinfp->in_seq);
+	if(jnmode == JNREC) jnput(ff);
+list:
 	/*
 	 * Decide now whether listing of this line is enabled.
 	 */
@@ -129,6 +141,7 @@ static	char	lstfmt[] = "%-3s %-4s %-8s %-5s %s";
 
 	if(pass2) {
 		if(*llerr) {  /* put out an error listing line */
+			if(jobs) fprintf(ERROR,"%s: ",srcfile);
 			fprintf(ERROR,lstfmt,llerr,llloc, llobj,llseq,llsrc);
 		}
 		if(lflag && (llfull||*llerr)) {  /* put out assembly listing */
@@ -144,6 +157,67 @@ static	char	lstfmt[] = "%-3s %-4s %-8s %-5s %s";
 	llert = llerr;  llobt = llobj;
 }
 
+/*
+ * putchain - Prints a histogram of the lengths of the hash chains in
+ * one of the hash tables, for putstats().  len holds the chain lengths.
+ */
+putchain(name,len,n) char *name; uns *len; uns n; {
+
+uns	hist[HISTSZ];
+uns	i, max;
+
+	for(i=0 ; i<HISTSZ ; i++) hist[i] = 0;
+	max = 0;
+	for(i=0 ; i<n ; i++) {
+		hist[len[i]<HISTSZ-1 ? len[i] : HISTSZ-1]++;
+		if(len[i] > max) max = len[i];
+	}
+	printf("%s hash chains (%u, longest %u):",name,n,max);
+	for(i=0 ; i<HISTSZ ; i++)
+		printf(" %u%s:%u",i,i==HISTSZ-1?"+":"",hist[i]);
+	printf("\n");
+}
+
+/*
+ * putstats - Prints the statistics for -S, after the last pass.
+ */
+putstats() {
+
+uns	*len;
+struct	octab	*ocp;
+vmadr	p;
+uns	i;
+
+	printf("%u macro expansions, %u .input files, .input depth %u\n",
+	 mexct,incct,incdep);
+	printf("%u symbols, %u lookups, %u lookaside hits, %u links followed\n",
+	 symct,sylct,ashct,chnct);
+	printf("%u vm accesses, %u bytes of vm\n",vmgct,(uns)virtop);
+	if((len = (uns *)malloc((syhsiz>ochsiz?syhsiz:ochsiz)*sizeof *len))
+	 == NULL) {
+		fprintf(ERROR,"Out of memory\n");
+		exit(1);
+	}
+	for(i=0 ; i<syhsiz ; i++) {
+		len[i] = 0;
+		for(p=syhtab[i] ; p ; p=((struct sytab *)rfetch(p))->sy_lnk)
+			len[i]++;
+	}
+	putchain("Symbol",len,syhsiz);
+	for(i=0 ; i<ochsiz ; i++) {
+		len[i] = 0;
+		for(ocp=ochtab[i] ; ocp ; ocp=ocp->oc_lnk) len[i]++;
+	}
+	putchain("Opcode",len,ochsiz);
+	free(len);
+	for(i=0 ; i<secct ; i++) {
+		if(i == 0) printf("%-8s",".abs");
+		else printf("%-8.8s",
+		 ((struct sytab *)rfetch(sectab[i].se_sym))->sy_str);
+		printf("%8ld bytes\n",sectab[i].se_byt);
+	}
+}
+
 /*
  * symcmp - Compares two symbols, and returns a number which is:
  *
@@ -49,7 +49,7 @@ reg	int	act;			/* next action to take */
 reg	int	*smp;			/* pointer into semtab */
 int		semnum;			/* semantic number */
 
-	eflg = prevsem = uflg = 0;
+	eflg = prevsem = symflg = uflg = 0;
 	iipsp = &iips[IISIZ];
 	act = ptab[0];
 	parsing = 1;
@@ -232,21 +232,24 @@ int		c, i, j;
 
 	case 12:	/* <primary> ::= symbol */
 		xref((vmadr)p->ps_val1,0);
+		symflg = 1;
 		syp = rfetch((vmadr)p->ps_val1);
 		if(syp->sy_typ == STSEC) goto experr;
 		if(syp->sy_typ==STUND || syp->sy_rel==RBUND ||
-		 syp->sy_typ==STVAR&&pass2&&!(syp->sy_atr&SADP2)) {
+		 syp->sy_typ==STVAR&&(pass2||sizing)&&!(syp->sy_atr&SADP2)) {
 			err('U');  uflg = 1;
 			pl->ps_val0 = pl->ps_val1 = 0;
 			pl->ps_flg = OFFOR;
 		} else {
 			pl->ps_val0 = syp->sy_val;
 			pl->ps_val1 = syp->sy_rel;
-			pl->ps_flg = pass2&&!(syp->sy_atr&SADP2) ? OFFOR : 0;
+			pl->ps_flg = (pass2||sizing)&&!(syp->sy_atr&SADP2) ?
+			 OFFOR : 0;
 		}
 		break;
 
 	case 13:	/* <primary> ::= $ */
+		symflg = 1;
 		pl->ps_val0 = curloc;
 		pl->ps_val1 = cursec;
 		pl->ps_flg = 0;
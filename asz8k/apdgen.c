@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * apdgen - Turns the predef file into C for asz8k.
+ *
+ * Usage is:
+ *
+ *	apdgen asz8k.pd >asz8kpd.c
+ *
+ * The output holds the instruction format table (pdfmt), the format
+ * index of each instruction (pdidx, as fmindex() in asz8k.c builds it),
+ * the opcode table entries for the instructions and directives (pdoc),
+ * already hashed and chained into pdoch just as oclook() would have done
+ * it, and the predefined symbols (pdsym).  ochtab starts out as pdoch.
+ * predef() in asz8k.c uses these unless it finds a predef file to read
+ * instead.
+ */
+static	char	ident[] = "@(#)apdgen.c	1.0";
+
+#define	OHSHLOG	9		/* these must agree with acom.h */
+#define	SYMSIZ	8
+#define	OPMAX	4		/* and this with asz8k.h */
+#define	OCMSK	0x1f
+#define	FIMAX	32
+#define	OTINS	1
+#define	OTDIR	2
+
+#define	MAXFMT	1024		/* maximum number of format entries */
+#define	MAXIDX	512		/* maximum number of instructions */
+#define	MAXOC	512		/* maximum number of opcodes */
+#define	MAXSYM	256		/* maximum number of predefined symbols */
+#define	MAXTOK	16		/* maximum tokens in a line */
+
+struct	fmt {
+	long	f_op[OPMAX];
+	long	f_skel;
+	long	f_flg;
+} fmt[MAXFMT];
+int	nfmt;
+
+int	idx[MAXIDX];		/* first format of each instruction */
+int	nidx;
+
+struct	oc {
+	int	o_lnk;			/* next in hash chain, or -1 */
+	int	o_typ;
+	long	o_val;			/* idx entry for an instruction */
+	char	o_str[SYMSIZ+1];
+} oc[MAXOC];
+int	noc;
+int	ochtab[1<<OHSHLOG];
+
+struct	sym {
+	long	s_val;
+	char	s_str[SYMSIZ+1];
+} sym[MAXSYM];
+int	nsym;
+
+char	*pdname;
+int	lineno;
+char	line[256];
+char	*tok[MAXTOK];
+int	ntok;
+
+long	con();
+struct	oc	*oclook();
+
+/*
+ * main
+ */
+main(argc,argv) int argc; char *argv[]; {
+
+FILE	*fp;
+int	i, sect, f;
+struct	oc	*op;
+
+	if(argc != 2) {
+		fprintf(stderr,"Usage:  apdgen file.pd\n");
+		exit(1);
+	}
+	pdname = argv[1];
+	if((fp = fopen(pdname,"r")) == NULL) {
+		fprintf(stderr,"Cannot open %s\n",pdname);
+		exit(1);
+	}
+	for(i=0 ; i<1<<OHSHLOG ; i++) ochtab[i] = -1;
+
+	/*
+	 * Read the three sections: instructions, directives and symbols,
+	 * each ended by an empty line.
+	 */
+	sect = 0;  f = -1;
+	while(sect<3 && rdline(fp)) {
+		if(ntok == 0) {
+			if(f >= 0) bad("unfinished instruction");
+			sect++;
+			continue;
+		}
+		switch(sect) {
+
+		case 0:		/* format entry, maybe with mnemonics */
+			if(ntok < OPMAX+2) bad("short format entry");
+			if(nfmt >= MAXFMT) bad("too many format entries");
+			if(f < 0) f = nfmt;
+			for(i=0 ; i<OPMAX ; i++) fmt[nfmt].f_op[i] = con(tok[i]);
+			fmt[nfmt].f_skel = con(tok[OPMAX]);
+			fmt[nfmt].f_flg = con(tok[OPMAX+1]);
+			nfmt++;
+			if(ntok == OPMAX+2) break;
+			fmt[nfmt-1].f_flg |= 0x8000;	/* FMLAST */
+			if(nidx >= MAXIDX) bad("too many instructions");
+			idx[nidx] = f;
+			for(i=OPMAX+2 ; i<ntok ; i++) {
+				op = oclook(tok[i]);
+				op->o_typ = OTINS;  op->o_val = nidx;
+			}
+			nidx++;
+			f = -1;
+			break;
+
+		case 1:		/* directive number and mnemonics */
+			for(i=1 ; i<ntok ; i++) {
+				op = oclook(tok[i]);
+				op->o_typ = OTDIR;  op->o_val = con(tok[0]);
+			}
+			break;
+
+		case 2:		/* symbol value and mnemonics */
+			for(i=1 ; i<ntok ; i++) {
+				if(nsym >= MAXSYM) bad("too many symbols");
+				if(strlen(tok[i]) > SYMSIZ) bad("symbol too long");
+				strcpy(sym[nsym].s_str,tok[i]);
+				sym[nsym++].s_val = con(tok[0]);
+			}
+			break;
+		}
+	}
+	if(sect<2 || f>=0) bad("premature end of file");
+	fclose(fp);
+	output();
+	exit(0);
+}
+
+/*
+ * bad - Complains about the predef file and quits.
+ */
+bad(s) char *s; {
+
+	fprintf(stderr,"%s: line %d: %s\n",pdname,lineno,s);
+	exit(1);
+}
+
+/*
+ * con - Returns the value of a constant, in the radixes asz8k allows.
+ */
+long
+con(s) char *s; {
+
+char	*p;
+int	c, radix;
+long	v;
+
+	p = s + strlen(s) - 1;
+	switch(*p | 040) {
+
+	case 'b':	radix = 2;  break;
+	case 'd':	radix = 10;  break;
+	case 'h':	radix = 16;  break;
+	case 'o':
+	case 'q':	radix = 8;  break;
+
+	default:
+		radix = 10;  p++;
+		break;
+	}
+	if(s == p) bad("bad constant");
+	v = 0;
+	while(s < p) {
+		c = *s++ | 040;
+		if('0'<=c && c<='9') c -= '0';
+		else if('a'<=c && c<='z') c += 10-'a';
+		else bad("bad constant");
+		if(c >= radix) bad("bad constant");
+		v = v*radix+c;
+	}
+	return(v);
+}
+
+/*
+ * rdline - Reads a line of the predef file and splits it into tokens.
+ * Returns 0 at end of file.
+ */
+rdline(fp) FILE *fp; {
+
+char	*p;
+
+	if(fgets(line,sizeof line,fp) == NULL) return(0);
+	lineno++;
+	ntok = 0;
+	for(p=strtok(line," \t\n") ; p ; p=strtok(NULL," \t\n")) {
+		if(ntok >= MAXTOK) bad("too many tokens");
+		tok[ntok++] = p;
+	}
+	return(1);
+}
+
+/*
+ * hash - Same as hash() in a.look.c.
+ */
+unsigned
+hash(s) char *s; {
+
+unsigned long h;
+int	i;
+
+	h = 2166136261L;
+	for(i=0 ; i<SYMSIZ && s[i] ; i++)
+		h = (h^s[i]&0377)*16777619L & 0xffffffffL;
+	return(h^h>>16);
+}
+
+/*
+ * oclook - Finds or adds an opcode, keeping the hash chains in the
+ * same order as oclook() in a.look.c does.
+ */
+struct oc *
+oclook(s) char *s; {
+
+int	h, p, q, cmp;
+
+	if(strlen(s) > SYMSIZ) bad("mnemonic too long");
+	h = hash(s)&(1<<OHSHLOG)-1;
+	p = -1;
+	q = ochtab[h];
+	while(q>=0 && (cmp=strcmp(s,oc[q].o_str))>0) {
+		p = q;
+		q = oc[q].o_lnk;
+	}
+	if(q>=0 && cmp==0) return(&oc[q]);
+	if(noc >= MAXOC) bad("too many opcodes");
+	strcpy(oc[noc].o_str,s);
+	oc[noc].o_lnk = q;
+	if(p >= 0) oc[p].o_lnk = noc; else ochtab[h] = noc;
+	return(&oc[noc++]);
+}
+
+/*
+ * output - Writes the tables out as C.
+ */
+output() {
+
+int	i, j, k, n;
+long	map[OPMAX][OCMSK+1];
+
+	printf("/*\n * Generated from %s by apdgen.  Do not edit.\n */\n",pdname);
+	printf("#include <stdio.h>\n#include \"acom.h\"\n#include \"asz8k.h\"\n\n");
+
+	printf("struct\tformat\tpdfmt[] = {\n");
+	for(i=0 ; i<nfmt ; i++) {
+		printf("\t{{");
+		for(j=0 ; j<OPMAX ; j++)
+			printf("%s0x%lx",j?",":"",fmt[i].f_op[j]);
+		printf("},0x%lx,0x%lx},\n",fmt[i].f_skel,fmt[i].f_flg);
+	}
+	printf("};\n\n");
+
+	printf("struct\tfmidx\tpdidx[] = {\n");
+	for(i=0 ; i<nidx ; i++) {
+		n = (i+1<nidx ? idx[i+1] : nfmt) - idx[i];
+		for(j=0 ; j<OPMAX ; j++)
+			for(k=0 ; k<=OCMSK ; k++) map[j][k] = 0;
+		for(k=0 ; k<n && k<FIMAX ; k++)
+			for(j=0 ; j<OPMAX ; j++)
+				map[j][fmt[idx[i]+k].f_op[j]&OCMSK] |= 1L<<k;
+		printf("\t{&pdfmt[%d],%d,{",idx[i],n);
+		for(j=0 ; j<OPMAX ; j++)
+			for(k=0 ; k<=OCMSK ; k++)
+				if(map[j][k])
+					printf("[%d][%d]=0x%lx,",j,k,map[j][k]);
+		printf("}},\n");
+	}
+	printf("};\n\n");
+
+	printf("struct\toctab\tpdoc[] = {\n");
+	for(i=0 ; i<noc ; i++) {
+		if(oc[i].o_lnk >= 0) printf("\t{&pdoc[%d],",oc[i].o_lnk);
+		else printf("\t{0,");
+		if(oc[i].o_typ == OTINS)
+			printf("(long)&pdidx[%ld],OTINS,",oc[i].o_val);
+		else
+			printf("%ld,OTDIR,",oc[i].o_val);
+		printf("0,\"%s\"},\n",oc[i].o_str);
+	}
+	printf("};\n\n");
+
+	printf("struct\toctab\t*pdoch[1<<OHSHLOG] = {\n");
+	for(i=0 ; i<1<<OHSHLOG ; i++) {
+		if(ochtab[i] >= 0) printf("\t&pdoc[%d],\n",ochtab[i]);
+		else printf("\t0,\n");
+	}
+	printf("};\n");
+	printf("struct\toctab\t**ochtab = pdoch;\n");
+	printf("uns\t\tochsiz = 1<<OHSHLOG;\n");
+	printf("uns\t\tocct = %d;\n\n",noc);
+
+	printf("struct\tpdsym\tpdsym[] = {\n");
+	for(i=0 ; i<nsym ; i++)
+		printf("\t{\"%s\",0x%lx},\n",sym[i].s_str,sym[i].s_val);
+	printf("\t{0}\n};\n");
+}
@@ -7,12 +7,35 @@
 #include "obj.h"
 
 /*
+ * Version Z.2.  Added relax(), which sizes jr, jp and djnz for -r.
+ *
+ * Version Z.1.  The predef tables are built in (asz8kpd.c, made from
+ * asz8k.pd by apdgen); a predef file, if found, replaces them.
+ *
  * Version 3.4, 8/27/82.  Changes to accomodate 8086 version.
  *
  * Version 3.3, 5/22/82.  Added PDDIR define for predef directory.
  */
 static	char	ident[] = "@(#)asz8k.c	3.4";
 
+extern	struct	operand	optab[OPMAX];	/* acom.h leaves out the size */
+
+struct	fmidx	*jpidx;		/* formats of jp, for relax() */
+struct	fmidx	*jridx;		/* formats of jr */
+
+/*
+ * brinit - Finds the instructions relax() turns branches into.
+ */
+brinit() {
+
+struct	octab	*ocp;
+
+	if((ocp = oclook("jp"))->oc_typ == OTINS)
+		jpidx = (struct fmidx *)ocp->oc_val;
+	if((ocp = oclook("jr"))->oc_typ == OTINS)
+		jridx = (struct fmidx *)ocp->oc_val;
+}
+
 /*
  * direc - Processes assembler directives which are special to this
  * assembler.  Calls dircom to process other directives.
@@ -133,7 +156,7 @@ equ(symtype) int symtype; {
 	if(toktyp != TKSPC) goto synerr;
 	iilex();
 	if(iiparse()!=0 || !(curop.op_cls&1L<<OCEXP)) goto synerr;
-	if(!(eflg||uflg) || pass2)
+	if(!(eflg||uflg) || pass2 || sizing)
 		assign(symtype,curop.op_val,curop.op_rel);
 	return;
 synerr:
@@ -190,7 +213,28 @@ struct	operand	*opp;
 /*
  * instr - Generates the specified machine instruction.
  */
-instr(fmp) struct format *fmp; {
+instr(fip) struct fmidx *fip; {
+
+struct	format	*fmp, *fmsel(), *relax();
+
+	if(curloc & 01)		/* Force word alignment */
+		curloc++;
+	label = *labstr?sylook(labstr):0;
+	assign(STLAB,curloc,cursec);
+	inops();  /* read the instruction operands */
+	if((fmp = fmsel(fip)) == 0) {
+		err('O');
+		return;
+	}
+	if(rflag) fmp = relax(fmp);
+	genins(fmp);
+}
+
+/*
+ * genins - Generates a machine instruction in the specified format, with
+ * the operands in optab.
+ */
+genins(fmp) struct format *fmp; {
 
 long	v,
 	dispval,
@@ -201,6 +245,7 @@ int	displen,
 	i,
 	immlen,
 	immrel,
+	note,
 	r,
 	skel0,
 	skel1,
@@ -208,16 +253,7 @@ int	displen,
 	skel3,
 	srel1;
 
-	if(curloc & 01)		/* Force word alignment */
-		curloc++;
-	label = *labstr?sylook(labstr):0;
-	assign(STLAB,curloc,cursec);
-	inops();  /* read the instruction operands */
-	while(!opmatch(fmp)) {  /* scan for matching format entry */
-		if(fmp->fm_flg&FMLAST) goto nomatch;
-		fmp++;
-	}
-	displen = immlen = 0;
+	displen = immlen = note = 0;
 	/*
 	 * Build up the instruction's fields.
 	 */
@@ -350,6 +386,7 @@ int	displen,
 			if(r!=cursec || v&01 || v<0 || v>=(2*128))
 				err('E');
 			skel1 |= v >> 1;
+			note = RNR7;
 			break;
 
 		case OARA8:	/* Generate 8-bit relative address */
@@ -357,6 +394,7 @@ int	displen,
 			if(r!=cursec || v&01 || v<(2*-128) || v>=(2*128))
 				err('E');
 			skel1 |= v >> 1;
+			note = RNR8;
 			break;
 
 		case OARA12:	/* Generate 12-bit relative address */
@@ -365,6 +403,7 @@ int	displen,
 				err('E');
 			skel0 |= (v>>9) & 0x0f;
 			skel1 = (v>>1) & 0xff;
+			note = RNR12;
 			break;
 		
 		case OARA16:	/* Generate 16-bit relative address */
@@ -379,6 +418,7 @@ int	displen,
 			immlen = 2;
 			immrel = 0;
 			immval = v & 0xffff;
+			note = RNR16;
 			break;
 		
 		case OAIMM8:	/* Generate 8-bit immediate */
@@ -407,7 +447,15 @@ int	displen,
 			break;
 		}
 	}
-	emitb(skel0, 0);
+	/*
+	 * Tell the linker about relative addresses, which it has to
+	 * redo if it moves code, and about direct jumps and calls, which
+	 * it may turn into relative ones.
+	 */
+	if(!segflg && displen==2 && (skel1&0xf0)==0 &&
+	 (skel0==0x5e || skel0==0x5f && skel1==0))
+		note = RNJMP;
+	emitb(skel0, note?RAZNOT|note:0);
 	emitb(skel1, RAA8|srel1);
 	if(fmp->fm_flg & FMSKEL2) {
 		if(fmp->fm_flg & FMNEGI)	/* Fake -1 immed. for R shift */
@@ -454,10 +502,59 @@ int	displen,
 		else
 			emitlm(immval, RAA32M|immrel);
 	}
-	return;
+}
+
+/*
+ * fmindex - Builds the format index for the instruction whose format
+ * entries start at fmp, and returns a pointer to it.
+ */
+struct fmidx *
+fmindex(fmp) struct format *fmp; {
+
+struct	fmidx	*fip;
+int	i, j;
+
+	fip = (struct fmidx *)palloc(sizeof(struct fmidx));
+	fip->fi_fmt = fmp;
+	for(i=0 ; i<OPMAX ; i++)
+		for(j=0 ; j<=OCMSK ; j++) fip->fi_map[i][j] = 0;
+	for(j=0 ; ; j++) {
+		if(j < FIMAX) for(i=0 ; i<OPMAX ; i++)
+			fip->fi_map[i][fmp[j].fm_op[i]&OCMSK] |= 1<<j;
+		if(fmp[j].fm_flg&FMLAST) break;
+	}
+	fip->fi_cnt = j+1;
+	return(fip);
+}
 
-nomatch:
-	err('O');
+/*
+ * fmsel - Returns a pointer to the first format entry of an instruction
+ * that matches the operands in optab, or 0 if none does.  Each operand's
+ * classes pick out, through the index, the set of entries they fit; the
+ * entry wanted is the first one in all of the sets.
+ */
+struct format *
+fmsel(fip) struct fmidx *fip; {
+
+reg	uns	set, m;
+reg	long	cls;
+struct	format	*fmp;
+int	i, c;
+
+	if(fip->fi_cnt > FIMAX) {  /* too many to index, so scan */
+		for(fmp=fip->fi_fmt ; !opmatch(fmp) ; fmp++)
+			if(fmp->fm_flg&FMLAST) return(0);
+		return(fmp);
+	}
+	set = ~0;
+	for(i=0 ; i<OPMAX ; i++) {
+		m = 0;
+		for(cls=optab[i].op_cls, c=0 ; cls ; cls>>=1, c++)
+			if(cls&1) m |= fip->fi_map[i][c];
+		if((set &= m) == 0) return(0);
+	}
+	for(i=0 ; !(set&1) ; i++) set >>= 1;
+	return(fip->fi_fmt+i);
 }
 
 /*
@@ -475,13 +572,16 @@ int	i;
 }
 
 /*
- * predef - Reads the predefined symbols into the symbol table.
+ * predef - Reads the predefined symbols into the symbol table.  The
+ * instructions and directives are already in ochtab, and the symbols in
+ * pdsym, unless a predef file turns up to take their place.
  */
 predef() {
 
 struct	format	*fmp;
 struct	octab	*ocp;
 struct	sytab	*syp;
+struct	pdsym	*psp;
 int	i;
 long	val;
 char		predef[256];
@@ -493,14 +593,21 @@ char		predef[256];
 	if(include(predef) == -1) {
 		sprintf(predef,"%s/%s.pd",PDDIR,prname);
 		if(include(predef) == -1) {
-			fprintf(ERROR,"No PREDEF file (%s.pd)\n",prname);
-			exit(1);
+			for(psp=pdsym ; psp->pd_str ; psp++) {
+				syp = wfetch(sylook(psp->pd_str));
+				syp->sy_typ = STKEY;
+				syp->sy_val = psp->pd_val;
+				syp->sy_atr = SADP2;
+			}
+			brinit();
+			return;
 		}
 	}
+	for(i=0 ; i<ochsiz ; i++) ochtab[i] = 0;
+	occt = 0;
 	while(token() == TKCON) {  /* read machine instructions */
-		val = (long)phytop;
+		val = (long)(fmp = palloc(sizeof(struct format)));
 		for(;;) {  /* read format table entries */
-			fmp = palloc(sizeof(struct format));
 			for(i=0 ; i<OPMAX ; i++) {  /* operand descriptors */
 				fmp->fm_op[i] = tokval;
 				preget(TKSPC);  preget(TKCON);
@@ -510,8 +617,10 @@ char		predef[256];
 			fmp->fm_flg = preget(TKCON);
 			if(token() != TKEOL) break;
 			preget(TKCON);
+			fmp = palloc(sizeof(struct format));
 		}
 		fmp->fm_flg |= FMLAST;
+		val = (long)fmindex((struct format *)val);
 		while(toktyp == TKSPC) {  /* read instruction mnemonics */
 			preget(TKSYM);  ocp = oclook(tokstr);
 			ocp->oc_typ = OTINS;  ocp->oc_val = val;
@@ -540,6 +649,75 @@ char		predef[256];
 		if(toktyp != TKEOL) badpre();
 	}
 	preget(TKEOF);
+	brinit();
+}
+
+/*
+ * relax - Sizes a branch for -r, and returns the format to generate it
+ * with.  A jr whose target is out of reach becomes a jp with the same
+ * condition, and a jp to an address within reach becomes a jr.  A djnz
+ * or dbjnz that cannot reach its target branches back to a jp instead,
+ * with a jr to take the fall-through path around the jp:
+ *
+ *		jr	1f
+ *	2:	jp	target
+ *	1:	djnz	r,2b
+ *
+ * Other instructions come back unchanged.
+ */
+struct format *
+relax(fmp) struct format *fmp; {
+
+struct	format	*alt;
+struct	operand	ctr, tgt;
+int	a, i, fits, jplen;
+long	d;
+exprval	brfrom();
+
+	if(jpidx==0 || jridx==0) return(fmp);
+	for(i=0 ; i<OPMAX ; i++) {  /* find the target operand */
+		a = fmp->fm_op[i] & OAMSK;
+		if(a==OARA7 || a==OARA8) break;
+		if(a==OAX2 && fmp>=jpidx->fi_fmt &&
+		 fmp<jpidx->fi_fmt+jpidx->fi_cnt) break;
+	}
+	if(i >= OPMAX) return(fmp);
+	if(a==OAX2 && (alt = fmsel(jridx))==0)  /* not to a plain address */
+		return(fmp);
+	tgt = optab[i];
+	if(tgt.op_rel == cursec) {
+		if(a == OARA7) {
+			d = curloc+2 - tgt.op_val;
+			fits = 0<=d && d<2*128;
+		} else {
+			d = tgt.op_val -
+			 ((tgt.op_flg&OFFOR ? brfrom() : curloc)+2);
+			fits = 2*-128<=d && d<2*128;
+		}
+	} else  /* fits only if not defined yet */
+		fits = (tgt.op_flg&OFFOR) && !sizing;
+	if(a == OAX2) return(brlong(fits) ? fmp : alt);
+	if(!brlong(fits)) return(fmp);
+	if(a == OARA8) return((alt = fmsel(jpidx)) ? alt : fmp);
+	/*
+	 * Generate the jr and the jp, and leave the djnz to the caller.
+	 */
+	ctr = optab[0];
+	jplen = segflg && !(tgt.op_flg&OFSHORT) ? 6 : 4;
+	optab[0].op_cls = 1L<<OCEXP | 1L<<OCNEX | 1L<<OCX;
+	optab[0].op_val = curloc+2+jplen;
+	optab[0].op_rel = cursec;
+	optab[0].op_flg = 0;
+	optab[1].op_cls = 1L<<OCNULL;
+	genins(fmsel(jridx));
+	optab[0] = tgt;
+	genins(fmsel(jpidx));
+	optab[0] = ctr;
+	optab[1] = tgt;
+	optab[1].op_val = curloc-jplen;
+	optab[1].op_rel = cursec;
+	optab[1].op_flg = 0;
+	return(fmp);
 }
 
 /*
@@ -7,6 +7,7 @@
 /*
  * Parameters.
  */
+#define	FIMAX	32		/* maximum formats in an instruction's index */
 #define	OPMAX	4		/* maximum number of instruction operands */
 /*
  * Instruction format table flags (in fm_flg).
@@ -92,7 +93,20 @@ struct	format {		/* instruction format table entry */
 	int	fm_skel;		/* opcode skeleton word */
 	int	fm_flg;			/* flags */
 };
+struct	fmidx {			/* format index for one instruction */
+	struct	format	*fi_fmt;	/* first format entry */
+	int	fi_cnt;			/* number of format entries */
+	uns	fi_map[OPMAX][OCMSK+1];	/* formats taking each operand class */
+};
+struct	pdsym {			/* built-in predefined symbol */
+	char	*pd_str;		/* symbol mnemonic string */
+	long	pd_val;			/* value of symbol */
+};
 /*
  * Global variable declarations.
  */
 char		segflg;		/* Generate code for segmented processor */
+extern	struct	format	pdfmt[];	/* built-in formats (asz8kpd.c) */
+extern	struct	fmidx	pdidx[];	/* built-in format indexes (asz8kpd.c) */
+extern	struct	octab	pdoc[];		/* built-in opcodes (asz8kpd.c) */
+extern	struct	pdsym	pdsym[];	/* built-in symbols (asz8kpd.c) */
@@ -39,3 +39,4 @@ uns		minaln = 1;
 struct	operand	optab[OPMAX] = {0};
 char		segflg = 0;
 char		oflag = 0;
+char		xoflag = 0;
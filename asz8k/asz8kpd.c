@@ -0,0 +1,1729 @@
+/*
+ * Generated from asz8k.pd by apdgen.  Do not edit.
+ */
+#include <stdio.h>
+#include "acom.h"
+#include "asz8k.h"
+
+struct	format	pdfmt[] = {
+	{{0x305,0x205,0x0,0x0},0xb500,0x8000},
+	{{0x304,0x204,0x0,0x0},0xb400,0x8000},
+	{{0x305,0x205,0x0,0x0},0x8100,0x0},
+	{{0x305,0x1d08,0x0,0x0},0x100,0x0},
+	{{0x305,0x209,0x0,0x0},0x100,0x0},
+	{{0x305,0x90a,0x0,0x0},0x4100,0x8000},
+	{{0x304,0x204,0x0,0x0},0x8000,0x0},
+	{{0x304,0x1c08,0x0,0x0},0x0,0x0},
+	{{0x304,0x209,0x0,0x0},0x0,0x0},
+	{{0x304,0x90a,0x0,0x0},0x4000,0x8000},
+	{{0x306,0x206,0x0,0x0},0x9600,0x0},
+	{{0x306,0x1e08,0x0,0x0},0x1600,0x0},
+	{{0x306,0x209,0x0,0x0},0x1600,0x0},
+	{{0x306,0x90a,0x0,0x0},0x5600,0x8000},
+	{{0x305,0x205,0x0,0x0},0x8700,0x0},
+	{{0x305,0x1d08,0x0,0x0},0x700,0x0},
+	{{0x305,0x209,0x0,0x0},0x700,0x0},
+	{{0x305,0x90a,0x0,0x0},0x4700,0x8000},
+	{{0x304,0x204,0x0,0x0},0x8600,0x0},
+	{{0x304,0x1c08,0x0,0x0},0x600,0x0},
+	{{0x304,0x209,0x0,0x0},0x600,0x0},
+	{{0x304,0x90a,0x0,0x0},0x4600,0x8000},
+	{{0x205,0x308,0x0,0x0},0xa700,0x0},
+	{{0x209,0x308,0x0,0x0},0x2700,0x0},
+	{{0x90a,0x308,0x0,0x0},0x6700,0x0},
+	{{0x505,0x305,0x0,0x0},0x2700,0x8010},
+	{{0x204,0x1108,0x0,0x0},0xa600,0x0},
+	{{0x209,0x1108,0x0,0x0},0x2600,0x0},
+	{{0x90a,0x1108,0x0,0x0},0x6600,0x0},
+	{{0x504,0x1105,0x0,0x0},0x2600,0x8010},
+	{{0x209,0x0,0x0,0x0},0x1f00,0x0},
+	{{0x90a,0x0,0x0,0x0},0x5f00,0x8000},
+	{{0x1a03,0x0,0x0,0x0},0xd000,0x8000},
+	{{0x205,0x0,0x0,0x0},0x8d08,0x0},
+	{{0x209,0x0,0x0,0x0},0xd08,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4d08,0x8000},
+	{{0x204,0x0,0x0,0x0},0x8c08,0x0},
+	{{0x209,0x0,0x0,0x0},0xc08,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4c08,0x8000},
+	{{0x205,0x0,0x0,0x0},0x8d00,0x0},
+	{{0x209,0x0,0x0,0x0},0xd00,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4d00,0x8000},
+	{{0x204,0x0,0x0,0x0},0x8c00,0x0},
+	{{0x209,0x0,0x0,0x0},0xc00,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4c00,0x8000},
+	{{0xf0e,0x0,0x0,0x0},0x8d05,0x0},
+	{{0xf0e,0xf0e,0x0,0x0},0x8d05,0x0},
+	{{0xf0e,0xf0e,0xf0e,0x0},0x8d05,0x0},
+	{{0xf0e,0xf0e,0xf0e,0xf0e},0x8d05,0x8000},
+	{{0x305,0x205,0x0,0x0},0x8b00,0x0},
+	{{0x305,0x1d08,0x0,0x0},0xb00,0x0},
+	{{0x305,0x209,0x0,0x0},0xb00,0x0},
+	{{0x305,0x90a,0x0,0x0},0x4b00,0x0},
+	{{0x209,0x1d08,0x0,0x0},0xd01,0x0},
+	{{0x90a,0x1d08,0x0,0x0},0x4d01,0x8000},
+	{{0x304,0x204,0x0,0x0},0x8a00,0x0},
+	{{0x304,0x1c08,0x0,0x0},0xa00,0x0},
+	{{0x304,0x209,0x0,0x0},0xa00,0x0},
+	{{0x304,0x90a,0x0,0x0},0x4a00,0x0},
+	{{0x209,0x1c08,0x0,0x0},0xc01,0x0},
+	{{0x90a,0x1c08,0x0,0x0},0x4c01,0x8000},
+	{{0x306,0x206,0x0,0x0},0x9000,0x0},
+	{{0x306,0x1e08,0x0,0x0},0x1000,0x0},
+	{{0x306,0x209,0x0,0x0},0x1000,0x0},
+	{{0x306,0x90a,0x0,0x0},0x5000,0x8000},
+	{{0x605,0x209,0x505,0x70d},0xbb08,0x8010},
+	{{0x604,0x209,0x505,0x70d},0xba08,0x8010},
+	{{0x605,0x209,0x505,0x70d},0xbb0c,0x8010},
+	{{0x604,0x209,0x505,0x70d},0xba0c,0x8010},
+	{{0x605,0x209,0x505,0x70d},0xbb00,0x8010},
+	{{0x604,0x209,0x505,0x70d},0xba00,0x8010},
+	{{0x605,0x209,0x505,0x70d},0xbb04,0x8010},
+	{{0x604,0x209,0x505,0x70d},0xba04,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xbb0a,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xba0a,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xbb0e,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xba0e,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xbb02,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xba02,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xbb06,0x8010},
+	{{0x609,0x209,0x505,0x70d},0xba06,0x8010},
+	{{0x204,0x0,0x0,0x0},0xb000,0x8000},
+	{{0x205,0x0,0x0,0x0},0xab00,0x0},
+	{{0x209,0x0,0x0,0x0},0x2b00,0x0},
+	{{0x90a,0x0,0x0,0x0},0x6b00,0x0},
+	{{0x205,0x1308,0x0,0x0},0xab00,0x0},
+	{{0x209,0x1308,0x0,0x0},0x2b00,0x0},
+	{{0x90a,0x1308,0x0,0x0},0x6b00,0x8000},
+	{{0x204,0x0,0x0,0x0},0xaa00,0x0},
+	{{0x209,0x0,0x0,0x0},0x2a00,0x0},
+	{{0x90a,0x0,0x0,0x0},0x6a00,0x0},
+	{{0x204,0x1308,0x0,0x0},0xaa00,0x0},
+	{{0x209,0x1308,0x0,0x0},0x2a00,0x0},
+	{{0x90a,0x1308,0x0,0x0},0x6a00,0x8000},
+	{{0x120f,0x0,0x0,0x0},0x7c03,0x0},
+	{{0x120f,0x120f,0x0,0x0},0x7c03,0x8000},
+	{{0x306,0x205,0x0,0x0},0x9b00,0x0},
+	{{0x306,0x1d08,0x0,0x0},0x1b00,0x0},
+	{{0x306,0x209,0x0,0x0},0x1b00,0x0},
+	{{0x306,0x90a,0x0,0x0},0x5b00,0x8000},
+	{{0x307,0x206,0x0,0x0},0x9a00,0x0},
+	{{0x307,0x1e08,0x0,0x0},0x1a00,0x0},
+	{{0x307,0x209,0x0,0x0},0x1a00,0x0},
+	{{0x307,0x90a,0x0,0x0},0x5a00,0x8000},
+	{{0x105,0x1803,0x0,0x0},0xf080,0x8000},
+	{{0x104,0x1803,0x0,0x0},0xf000,0x8000},
+	{{0x120f,0x0,0x0,0x0},0x7c07,0x0},
+	{{0x120f,0x120f,0x0,0x0},0x7c07,0x8000},
+	{{0x305,0x205,0x0,0x0},0xad00,0x0},
+	{{0x305,0x209,0x0,0x0},0x2d00,0x0},
+	{{0x305,0x90a,0x0,0x0},0x6d00,0x8000},
+	{{0x304,0x204,0x0,0x0},0xac00,0x0},
+	{{0x304,0x209,0x0,0x0},0x2c00,0x0},
+	{{0x304,0x90a,0x0,0x0},0x6c00,0x8000},
+	{{0x206,0x0,0x0,0x0},0xb10a,0x8000},
+	{{0x205,0x0,0x0,0x0},0xb100,0x8000},
+	{{0x207,0x0,0x0,0x0},0xb107,0x8000},
+	{{0x0,0x0,0x0,0x0},0x7a00,0x8000},
+	{{0x305,0x212,0x0,0x0},0x3d00,0x0},
+	{{0x205,0x1d03,0x0,0x0},0x3b04,0x8000},
+	{{0x304,0x212,0x0,0x0},0x3c00,0x0},
+	{{0x204,0x1d03,0x0,0x0},0x3a04,0x8000},
+	{{0x205,0x0,0x0,0x0},0xa900,0x0},
+	{{0x209,0x0,0x0,0x0},0x2900,0x0},
+	{{0x90a,0x0,0x0,0x0},0x6900,0x0},
+	{{0x205,0x1308,0x0,0x0},0xa900,0x0},
+	{{0x209,0x1308,0x0,0x0},0x2900,0x0},
+	{{0x90a,0x1308,0x0,0x0},0x6900,0x8000},
+	{{0x204,0x0,0x0,0x0},0xa800,0x0},
+	{{0x209,0x0,0x0,0x0},0x2800,0x0},
+	{{0x90a,0x0,0x0,0x0},0x6800,0x0},
+	{{0x204,0x1308,0x0,0x0},0xa800,0x0},
+	{{0x209,0x1308,0x0,0x0},0x2800,0x0},
+	{{0x90a,0x1308,0x0,0x0},0x6800,0x8000},
+	{{0x609,0x212,0x505,0x0},0x3b08,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3a08,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3b08,0x8010},
+	{{0x609,0x212,0x505,0x0},0x3a08,0x8010},
+	{{0x609,0x212,0x505,0x0},0x3b00,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3a00,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3b00,0x8010},
+	{{0x609,0x212,0x505,0x0},0x3a00,0x8010},
+	{{0x0,0x0,0x0,0x0},0x7b00,0x8000},
+	{{0x209,0x0,0x0,0x0},0x1e08,0x0},
+	{{0x90a,0x0,0x0,0x0},0x5e08,0x0},
+	{{0x30d,0x209,0x0,0x0},0x1e00,0x0},
+	{{0x30d,0x90a,0x0,0x0},0x5e00,0x8000},
+	{{0x1903,0x0,0x0,0x0},0xe800,0x0},
+	{{0x10d,0x1903,0x0,0x0},0xe000,0x8000},
+	{{0x305,0x205,0x0,0x0},0xa100,0x0},
+	{{0x305,0x1d08,0x0,0x0},0x2100,0x0},
+	{{0x305,0x209,0x0,0x0},0x2100,0x0},
+	{{0x305,0x90a,0x0,0x0},0x6100,0x0},
+	{{0x305,0xb0b,0x0,0x0},0x3100,0x0},
+	{{0x305,0xd0c,0x0,0x0},0x7100,0x10},
+	{{0x209,0x305,0x0,0x0},0x2f00,0x0},
+	{{0x90a,0x305,0x0,0x0},0x6f00,0x0},
+	{{0x209,0x1d08,0x0,0x0},0xd05,0x0},
+	{{0x90a,0x1d08,0x0,0x0},0x4d05,0x0},
+	{{0xb0b,0x305,0x0,0x0},0x3300,0x0},
+	{{0xd0c,0x305,0x0,0x0},0x7300,0x8010},
+	{{0x304,0x204,0x0,0x0},0xa000,0x0},
+	{{0x104,0x808,0x0,0x0},0xc000,0x0},
+	{{0x304,0x209,0x0,0x0},0x2000,0x0},
+	{{0x304,0x90a,0x0,0x0},0x6000,0x0},
+	{{0x304,0xb0b,0x0,0x0},0x3000,0x0},
+	{{0x304,0xd0c,0x0,0x0},0x7000,0x10},
+	{{0x209,0x304,0x0,0x0},0x2e00,0x0},
+	{{0x90a,0x304,0x0,0x0},0x6e00,0x0},
+	{{0x209,0x1c08,0x0,0x0},0xc05,0x0},
+	{{0x90a,0x1c08,0x0,0x0},0x4c05,0x0},
+	{{0xb0b,0x304,0x0,0x0},0x3200,0x0},
+	{{0xd0c,0x304,0x0,0x0},0x7200,0x8010},
+	{{0x306,0x206,0x0,0x0},0x9400,0x0},
+	{{0x306,0x1e08,0x0,0x0},0x1400,0x0},
+	{{0x306,0x209,0x0,0x0},0x1400,0x0},
+	{{0x306,0x90a,0x0,0x0},0x5400,0x0},
+	{{0x306,0xb0b,0x0,0x0},0x3500,0x0},
+	{{0x306,0xd0c,0x0,0x0},0x7500,0x10},
+	{{0x209,0x306,0x0,0x0},0x1d00,0x0},
+	{{0x90a,0x306,0x0,0x0},0x5d00,0x0},
+	{{0xb0b,0x306,0x0,0x0},0x3700,0x0},
+	{{0xd0c,0x306,0x0,0x0},0x7700,0x8010},
+	{{0x313,0x90a,0x0,0x0},0x7600,0x0},
+	{{0x313,0xb0b,0x0,0x0},0x3400,0x0},
+	{{0x313,0xd0c,0x0,0x0},0x7400,0x8010},
+	{{0x313,0x1b03,0x0,0x0},0x3400,0x8000},
+	{{0x11,0x204,0x0,0x0},0x8c09,0x0},
+	{{0x204,0x11,0x0,0x0},0x8c01,0x8000},
+	{{0x310,0x205,0x0,0x0},0x7d08,0x0},
+	{{0x205,0x310,0x0,0x0},0x7d00,0x8000},
+	{{0x609,0x209,0x505,0x0},0xbb09,0x8018},
+	{{0x609,0x209,0x505,0x0},0xba09,0x8018},
+	{{0x609,0x209,0x505,0x0},0xbb09,0x8010},
+	{{0x609,0x209,0x505,0x0},0xba09,0x8010},
+	{{0x609,0x209,0x505,0x0},0xbb01,0x8018},
+	{{0x609,0x209,0x505,0x0},0xba01,0x8018},
+	{{0x609,0x209,0x505,0x0},0xbb01,0x8010},
+	{{0x609,0x209,0x505,0x0},0xba01,0x8010},
+	{{0x205,0x308,0x0,0x0},0xbd00,0x8000},
+	{{0x505,0x209,0x1708,0x0},0x1c01,0x10},
+	{{0x505,0x90a,0x1708,0x0},0x5c01,0x10},
+	{{0x209,0x505,0x1708,0x0},0x1c09,0x10},
+	{{0x90a,0x505,0x1708,0x0},0x5c09,0x8010},
+	{{0x209,0x0,0x0,0x0},0x3900,0x0},
+	{{0x90a,0x0,0x0,0x0},0x7900,0x8000},
+	{{0x305,0x1b03,0x0,0x0},0x3100,0x0},
+	{{0x1b03,0x305,0x0,0x0},0x3300,0x8000},
+	{{0x304,0x1b03,0x0,0x0},0x3000,0x0},
+	{{0x1b03,0x304,0x0,0x0},0x3200,0x8000},
+	{{0x306,0x1b03,0x0,0x0},0x3500,0x0},
+	{{0x1b03,0x306,0x0,0x0},0x3700,0x8000},
+	{{0x0,0x0,0x0,0x0},0x7b0a,0x8000},
+	{{0x205,0x0,0x0,0x0},0x7b0d,0x8000},
+	{{0x0,0x0,0x0,0x0},0x7b09,0x8000},
+	{{0x0,0x0,0x0,0x0},0x7b08,0x8000},
+	{{0x306,0x205,0x0,0x0},0x9900,0x0},
+	{{0x306,0x1d08,0x0,0x0},0x1900,0x0},
+	{{0x306,0x209,0x0,0x0},0x1900,0x0},
+	{{0x306,0x90a,0x0,0x0},0x5900,0x8000},
+	{{0x307,0x206,0x0,0x0},0x9800,0x0},
+	{{0x307,0x1e08,0x0,0x0},0x1800,0x0},
+	{{0x307,0x209,0x0,0x0},0x1800,0x0},
+	{{0x307,0x90a,0x0,0x0},0x5800,0x8000},
+	{{0x205,0x0,0x0,0x0},0x8d02,0x0},
+	{{0x209,0x0,0x0,0x0},0xd02,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4d02,0x8000},
+	{{0x204,0x0,0x0,0x0},0x8c02,0x0},
+	{{0x209,0x0,0x0,0x0},0xc02,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4c02,0x8000},
+	{{0x0,0x0,0x0,0x0},0x8d07,0x8000},
+	{{0x305,0x205,0x0,0x0},0x8500,0x0},
+	{{0x305,0x1d08,0x0,0x0},0x500,0x0},
+	{{0x305,0x209,0x0,0x0},0x500,0x0},
+	{{0x305,0x90a,0x0,0x0},0x4500,0x8000},
+	{{0x304,0x204,0x0,0x0},0x8400,0x0},
+	{{0x304,0x1c08,0x0,0x0},0x400,0x0},
+	{{0x304,0x209,0x0,0x0},0x400,0x0},
+	{{0x304,0x90a,0x0,0x0},0x4400,0x8000},
+	{{0x612,0x209,0x505,0x0},0x3b0a,0x8010},
+	{{0x612,0x209,0x505,0x0},0x3a0a,0x8010},
+	{{0x612,0x209,0x505,0x0},0x3b02,0x8010},
+	{{0x612,0x209,0x505,0x0},0x3a02,0x8010},
+	{{0x212,0x305,0x0,0x0},0x3f00,0x0},
+	{{0x1d03,0x205,0x0,0x0},0x3b06,0x8000},
+	{{0x212,0x304,0x0,0x0},0x3e00,0x0},
+	{{0x1d03,0x204,0x0,0x0},0x3a06,0x8000},
+	{{0x612,0x209,0x505,0x0},0x3b0a,0x8018},
+	{{0x612,0x209,0x505,0x0},0x3a0a,0x8018},
+	{{0x612,0x209,0x505,0x0},0x3b02,0x8018},
+	{{0x612,0x209,0x505,0x0},0x3a02,0x8018},
+	{{0x305,0x209,0x0,0x0},0x9700,0x0},
+	{{0x309,0x209,0x0,0x0},0x1700,0x0},
+	{{0xa0a,0x209,0x0,0x0},0x5700,0x8000},
+	{{0x306,0x209,0x0,0x0},0x9500,0x0},
+	{{0x309,0x209,0x0,0x0},0x1500,0x0},
+	{{0xa0a,0x209,0x0,0x0},0x5500,0x8000},
+	{{0x209,0x305,0x0,0x0},0x9300,0x0},
+	{{0x209,0x309,0x0,0x0},0x1300,0x0},
+	{{0x209,0xa0a,0x0,0x0},0x5300,0x0},
+	{{0x209,0x1d08,0x0,0x0},0xd09,0x8000},
+	{{0x209,0x306,0x0,0x0},0x9100,0x0},
+	{{0x209,0x309,0x0,0x0},0x1100,0x0},
+	{{0x209,0xa0a,0x0,0x0},0x5100,0x8000},
+	{{0x205,0x308,0x0,0x0},0xa300,0x0},
+	{{0x209,0x308,0x0,0x0},0x2300,0x0},
+	{{0x90a,0x308,0x0,0x0},0x6300,0x0},
+	{{0x505,0x305,0x0,0x0},0x2300,0x8010},
+	{{0x204,0x1108,0x0,0x0},0xa200,0x0},
+	{{0x209,0x1108,0x0,0x0},0x2200,0x0},
+	{{0x90a,0x1108,0x0,0x0},0x6200,0x0},
+	{{0x504,0x1105,0x0,0x0},0x2200,0x8010},
+	{{0xf0e,0x0,0x0,0x0},0x8d03,0x0},
+	{{0xf0e,0xf0e,0x0,0x0},0x8d03,0x0},
+	{{0xf0e,0xf0e,0xf0e,0x0},0x8d03,0x0},
+	{{0xf0e,0xf0e,0xf0e,0xf0e},0x8d03,0x8000},
+	{{0x0,0x0,0x0,0x0},0x9e08,0x0},
+	{{0x30d,0x0,0x0,0x0},0x9e00,0x8000},
+	{{0x205,0x0,0x0,0x0},0xb300,0x0},
+	{{0x205,0x1f08,0x0,0x0},0xb300,0x8000},
+	{{0x204,0x0,0x0,0x0},0xb200,0x0},
+	{{0x204,0x1f08,0x0,0x0},0xb200,0x8000},
+	{{0x205,0x0,0x0,0x0},0xb308,0x0},
+	{{0x205,0x1f08,0x0,0x0},0xb308,0x8000},
+	{{0x204,0x0,0x0,0x0},0xb208,0x0},
+	{{0x204,0x1f08,0x0,0x0},0xb208,0x8000},
+	{{0x304,0x204,0x0,0x0},0xbe00,0x8000},
+	{{0x205,0x0,0x0,0x0},0xb304,0x0},
+	{{0x205,0x1f08,0x0,0x0},0xb304,0x8000},
+	{{0x204,0x0,0x0,0x0},0xb204,0x0},
+	{{0x204,0x1f08,0x0,0x0},0xb204,0x8000},
+	{{0x205,0x0,0x0,0x0},0xb30c,0x0},
+	{{0x205,0x1f08,0x0,0x0},0xb30c,0x8000},
+	{{0x204,0x0,0x0,0x0},0xb20c,0x0},
+	{{0x204,0x1f08,0x0,0x0},0xb20c,0x8000},
+	{{0x304,0x204,0x0,0x0},0xbc00,0x8000},
+	{{0x305,0x205,0x0,0x0},0xb700,0x8000},
+	{{0x304,0x204,0x0,0x0},0xb600,0x8000},
+	{{0x808,0x0,0x0,0x0},0x7f00,0x8000},
+	{{0x205,0x505,0x0,0x0},0xb30b,0x8010},
+	{{0x204,0x505,0x0,0x0},0xb20b,0x8010},
+	{{0x206,0x505,0x0,0x0},0xb30f,0x8010},
+	{{0x205,0x505,0x0,0x0},0xb303,0x8010},
+	{{0x204,0x505,0x0,0x0},0xb203,0x8010},
+	{{0x206,0x505,0x0,0x0},0xb307,0x8010},
+	{{0x205,0x308,0x0,0x0},0xa500,0x0},
+	{{0x209,0x308,0x0,0x0},0x2500,0x0},
+	{{0x90a,0x308,0x0,0x0},0x6500,0x0},
+	{{0x505,0x305,0x0,0x0},0x2500,0x8010},
+	{{0x204,0x1108,0x0,0x0},0xa400,0x0},
+	{{0x209,0x1108,0x0,0x0},0x2400,0x0},
+	{{0x90a,0x1108,0x0,0x0},0x6400,0x0},
+	{{0x504,0x1105,0x0,0x0},0x2400,0x8010},
+	{{0xf0e,0x0,0x0,0x0},0x8d01,0x0},
+	{{0xf0e,0xf0e,0x0,0x0},0x8d01,0x0},
+	{{0xf0e,0xf0e,0xf0e,0x0},0x8d01,0x0},
+	{{0xf0e,0xf0e,0xf0e,0xf0e},0x8d01,0x8000},
+	{{0x205,0x1d03,0x0,0x0},0x3b05,0x8000},
+	{{0x204,0x1d03,0x0,0x0},0x3a05,0x8000},
+	{{0x609,0x212,0x505,0x0},0x3b09,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3a09,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3b09,0x8010},
+	{{0x609,0x212,0x505,0x0},0x3a09,0x8010},
+	{{0x609,0x212,0x505,0x0},0x3b01,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3a01,0x8018},
+	{{0x609,0x212,0x505,0x0},0x3b01,0x8010},
+	{{0x609,0x212,0x505,0x0},0x3a01,0x8010},
+	{{0x205,0x0,0x0,0x0},0xb309,0x11},
+	{{0x205,0x1d08,0x0,0x0},0xb309,0x8000},
+	{{0x204,0x0,0x0,0x0},0xb209,0x11},
+	{{0x204,0x1d08,0x0,0x0},0xb209,0x8000},
+	{{0x206,0x0,0x0,0x0},0xb30d,0x11},
+	{{0x206,0x1d08,0x0,0x0},0xb30d,0x8000},
+	{{0x205,0x0,0x0,0x0},0xb301,0x11},
+	{{0x205,0x1d08,0x0,0x0},0xb301,0x8000},
+	{{0x204,0x0,0x0,0x0},0xb201,0x11},
+	{{0x204,0x1d08,0x0,0x0},0xb201,0x8000},
+	{{0x206,0x0,0x0,0x0},0xb305,0x11},
+	{{0x206,0x1d08,0x0,0x0},0xb305,0x8000},
+	{{0x612,0x209,0x505,0x0},0x3b0b,0x8010},
+	{{0x612,0x209,0x505,0x0},0x3a0b,0x8010},
+	{{0x612,0x209,0x505,0x0},0x3b03,0x8010},
+	{{0x612,0x209,0x505,0x0},0x3a03,0x8010},
+	{{0x1d03,0x205,0x0,0x0},0x3b07,0x8000},
+	{{0x1d03,0x204,0x0,0x0},0x3a07,0x8000},
+	{{0x612,0x209,0x505,0x0},0x3b0b,0x8018},
+	{{0x612,0x209,0x505,0x0},0x3a0b,0x8018},
+	{{0x612,0x209,0x505,0x0},0x3b03,0x8018},
+	{{0x612,0x209,0x505,0x0},0x3a03,0x8018},
+	{{0x205,0x0,0x0,0x0},0xb309,0x31},
+	{{0x205,0x1d08,0x0,0x0},0xb309,0x8020},
+	{{0x204,0x0,0x0,0x0},0xb209,0x31},
+	{{0x204,0x1d08,0x0,0x0},0xb209,0x8020},
+	{{0x206,0x0,0x0,0x0},0xb30d,0x31},
+	{{0x206,0x1d08,0x0,0x0},0xb30d,0x8020},
+	{{0x205,0x0,0x0,0x0},0xb301,0x31},
+	{{0x205,0x1d08,0x0,0x0},0xb301,0x8020},
+	{{0x204,0x0,0x0,0x0},0xb201,0x31},
+	{{0x204,0x1d08,0x0,0x0},0xb201,0x8020},
+	{{0x206,0x0,0x0,0x0},0xb305,0x31},
+	{{0x206,0x1d08,0x0,0x0},0xb305,0x8020},
+	{{0x305,0x205,0x0,0x0},0x8300,0x0},
+	{{0x305,0x1d08,0x0,0x0},0x300,0x0},
+	{{0x305,0x209,0x0,0x0},0x300,0x0},
+	{{0x305,0x90a,0x0,0x0},0x4300,0x8000},
+	{{0x304,0x204,0x0,0x0},0x8200,0x0},
+	{{0x304,0x1c08,0x0,0x0},0x200,0x0},
+	{{0x304,0x209,0x0,0x0},0x200,0x0},
+	{{0x304,0x90a,0x0,0x0},0x4200,0x8000},
+	{{0x306,0x206,0x0,0x0},0x9200,0x0},
+	{{0x306,0x1e08,0x0,0x0},0x1200,0x0},
+	{{0x306,0x209,0x0,0x0},0x1200,0x0},
+	{{0x306,0x90a,0x0,0x0},0x5200,0x8000},
+	{{0x30d,0x205,0x0,0x0},0xaf00,0x8000},
+	{{0x30d,0x204,0x0,0x0},0xae00,0x8000},
+	{{0x205,0x0,0x0,0x0},0x8d04,0x0},
+	{{0x209,0x0,0x0,0x0},0xd04,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4d04,0x8000},
+	{{0x204,0x0,0x0,0x0},0x8c04,0x0},
+	{{0x209,0x0,0x0,0x0},0xc04,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4c04,0x8000},
+	{{0x206,0x0,0x0,0x0},0x9c08,0x0},
+	{{0x209,0x0,0x0,0x0},0x1c08,0x0},
+	{{0x90a,0x0,0x0,0x0},0x5c08,0x8000},
+	{{0x209,0x609,0x505,0x0},0xb808,0x8010},
+	{{0x209,0x609,0x505,0x0},0xb80c,0x8010},
+	{{0x209,0x609,0x505,0x0},0xb800,0x8010},
+	{{0x209,0x609,0x505,0x0},0xb804,0x8010},
+	{{0x209,0x609,0x505,0x0},0xb80a,0x8010},
+	{{0x209,0x609,0x505,0x0},0xb80e,0x801e},
+	{{0x209,0x609,0x505,0x0},0xb802,0x8010},
+	{{0x209,0x609,0x505,0x0},0xb806,0x801e},
+	{{0x205,0x0,0x0,0x0},0x8d06,0x0},
+	{{0x209,0x0,0x0,0x0},0xd06,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4d06,0x8000},
+	{{0x204,0x0,0x0,0x0},0x8c06,0x0},
+	{{0x209,0x0,0x0,0x0},0xc06,0x0},
+	{{0x90a,0x0,0x0,0x0},0x4c06,0x8000},
+	{{0x305,0x205,0x0,0x0},0x8900,0x0},
+	{{0x305,0x1d08,0x0,0x0},0x900,0x0},
+	{{0x305,0x209,0x0,0x0},0x900,0x0},
+	{{0x305,0x90a,0x0,0x0},0x4900,0x8000},
+	{{0x304,0x204,0x0,0x0},0x8800,0x0},
+	{{0x304,0x1c08,0x0,0x0},0x800,0x0},
+	{{0x304,0x209,0x0,0x0},0x800,0x0},
+	{{0x304,0x90a,0x0,0x0},0x4800,0x8000},
+};
+
+struct	fmidx	pdidx[] = {
+	{&pdfmt[0],1,{[0][5]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[1],1,{[0][4]=0x1,[1][4]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[2],4,{[0][5]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[6],4,{[0][4]=0xf,[1][4]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[10],4,{[0][6]=0xf,[1][6]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[14],4,{[0][5]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[18],4,{[0][4]=0xf,[1][4]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[22],4,{[0][5]=0x9,[0][9]=0x2,[0][10]=0x4,[1][5]=0x8,[1][8]=0x7,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[26],4,{[0][4]=0x9,[0][9]=0x2,[0][10]=0x4,[1][5]=0x8,[1][8]=0x7,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[30],2,{[0][9]=0x1,[0][10]=0x2,[1][0]=0x3,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[32],1,{[0][3]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[33],3,{[0][5]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[36],3,{[0][4]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[39],3,{[0][5]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[42],3,{[0][4]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[45],4,{[0][14]=0xf,[1][0]=0x1,[1][14]=0xe,[2][0]=0x3,[2][14]=0xc,[3][0]=0x7,[3][14]=0x8,}},
+	{&pdfmt[49],6,{[0][5]=0xf,[0][9]=0x10,[0][10]=0x20,[1][5]=0x1,[1][8]=0x32,[1][9]=0x4,[1][10]=0x8,[2][0]=0x3f,[3][0]=0x3f,}},
+	{&pdfmt[55],6,{[0][4]=0xf,[0][9]=0x10,[0][10]=0x20,[1][4]=0x1,[1][8]=0x32,[1][9]=0x4,[1][10]=0x8,[2][0]=0x3f,[3][0]=0x3f,}},
+	{&pdfmt[61],4,{[0][6]=0xf,[1][6]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[65],1,{[0][5]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[66],1,{[0][4]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[67],1,{[0][5]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[68],1,{[0][4]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[69],1,{[0][5]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[70],1,{[0][4]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[71],1,{[0][5]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[72],1,{[0][4]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[73],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[74],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[75],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[76],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[77],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[78],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[79],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[80],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][13]=0x1,}},
+	{&pdfmt[81],1,{[0][4]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[82],6,{[0][5]=0x9,[0][9]=0x12,[0][10]=0x24,[1][0]=0x7,[1][8]=0x38,[2][0]=0x3f,[3][0]=0x3f,}},
+	{&pdfmt[88],6,{[0][4]=0x9,[0][9]=0x12,[0][10]=0x24,[1][0]=0x7,[1][8]=0x38,[2][0]=0x3f,[3][0]=0x3f,}},
+	{&pdfmt[94],2,{[0][15]=0x3,[1][0]=0x1,[1][15]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[96],4,{[0][6]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[100],4,{[0][7]=0xf,[1][6]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[104],1,{[0][5]=0x1,[1][3]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[105],1,{[0][4]=0x1,[1][3]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[106],2,{[0][15]=0x3,[1][0]=0x1,[1][15]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[108],3,{[0][5]=0x7,[1][5]=0x1,[1][9]=0x2,[1][10]=0x4,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[111],3,{[0][4]=0x7,[1][4]=0x1,[1][9]=0x2,[1][10]=0x4,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[114],1,{[0][6]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[115],1,{[0][5]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[116],1,{[0][7]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[117],1,{[0][0]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[118],2,{[0][5]=0x3,[1][3]=0x2,[1][18]=0x1,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[120],2,{[0][4]=0x3,[1][3]=0x2,[1][18]=0x1,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[122],6,{[0][5]=0x9,[0][9]=0x12,[0][10]=0x24,[1][0]=0x7,[1][8]=0x38,[2][0]=0x3f,[3][0]=0x3f,}},
+	{&pdfmt[128],6,{[0][4]=0x9,[0][9]=0x12,[0][10]=0x24,[1][0]=0x7,[1][8]=0x38,[2][0]=0x3f,[3][0]=0x3f,}},
+	{&pdfmt[134],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[135],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[136],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[137],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[138],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[139],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[140],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[141],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[142],1,{[0][0]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[143],4,{[0][9]=0x1,[0][10]=0x2,[0][13]=0xc,[1][0]=0x3,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[147],2,{[0][3]=0x1,[0][13]=0x2,[1][0]=0x1,[1][3]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[149],12,{[0][5]=0x3f,[0][9]=0x140,[0][10]=0x280,[0][11]=0x400,[0][12]=0x800,[1][5]=0xcc1,[1][8]=0x302,[1][9]=0x4,[1][10]=0x8,[1][11]=0x10,[1][12]=0x20,[2][0]=0xfff,[3][0]=0xfff,}},
+	{&pdfmt[161],12,{[0][4]=0x3f,[0][9]=0x140,[0][10]=0x280,[0][11]=0x400,[0][12]=0x800,[1][4]=0xcc1,[1][8]=0x302,[1][9]=0x4,[1][10]=0x8,[1][11]=0x10,[1][12]=0x20,[2][0]=0xfff,[3][0]=0xfff,}},
+	{&pdfmt[173],10,{[0][6]=0x3f,[0][9]=0x40,[0][10]=0x80,[0][11]=0x100,[0][12]=0x200,[1][6]=0x3c1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[1][11]=0x10,[1][12]=0x20,[2][0]=0x3ff,[3][0]=0x3ff,}},
+	{&pdfmt[183],3,{[0][19]=0x7,[1][10]=0x1,[1][11]=0x2,[1][12]=0x4,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[186],1,{[0][19]=0x1,[1][3]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[187],2,{[0][4]=0x2,[0][17]=0x1,[1][4]=0x1,[1][17]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[189],2,{[0][5]=0x2,[0][16]=0x1,[1][5]=0x1,[1][16]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[191],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[192],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[193],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[194],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[195],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[196],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[197],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[198],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[199],1,{[0][5]=0x1,[1][8]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[200],4,{[0][5]=0x3,[0][9]=0x4,[0][10]=0x8,[1][5]=0xc,[1][9]=0x1,[1][10]=0x2,[2][8]=0xf,[3][0]=0xf,}},
+	{&pdfmt[204],2,{[0][9]=0x1,[0][10]=0x2,[1][0]=0x3,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[206],2,{[0][3]=0x2,[0][5]=0x1,[1][3]=0x1,[1][5]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[208],2,{[0][3]=0x2,[0][4]=0x1,[1][3]=0x1,[1][4]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[210],2,{[0][3]=0x2,[0][6]=0x1,[1][3]=0x1,[1][6]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[212],1,{[0][0]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[213],1,{[0][5]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[214],1,{[0][0]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[215],1,{[0][0]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[216],4,{[0][6]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[220],4,{[0][7]=0xf,[1][6]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[224],3,{[0][5]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[227],3,{[0][4]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[230],1,{[0][0]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[231],4,{[0][5]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[235],4,{[0][4]=0xf,[1][4]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[239],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[240],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[241],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[242],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[243],2,{[0][3]=0x2,[0][18]=0x1,[1][5]=0x3,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[245],2,{[0][3]=0x2,[0][18]=0x1,[1][4]=0x3,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[247],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[248],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[249],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[250],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[251],3,{[0][5]=0x1,[0][9]=0x2,[0][10]=0x4,[1][9]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[254],3,{[0][6]=0x1,[0][9]=0x2,[0][10]=0x4,[1][9]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[257],4,{[0][9]=0xf,[1][5]=0x1,[1][8]=0x8,[1][9]=0x2,[1][10]=0x4,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[261],3,{[0][9]=0x7,[1][6]=0x1,[1][9]=0x2,[1][10]=0x4,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[264],4,{[0][5]=0x9,[0][9]=0x2,[0][10]=0x4,[1][5]=0x8,[1][8]=0x7,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[268],4,{[0][4]=0x9,[0][9]=0x2,[0][10]=0x4,[1][5]=0x8,[1][8]=0x7,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[272],4,{[0][14]=0xf,[1][0]=0x1,[1][14]=0xe,[2][0]=0x3,[2][14]=0xc,[3][0]=0x7,[3][14]=0x8,}},
+	{&pdfmt[276],2,{[0][0]=0x1,[0][13]=0x2,[1][0]=0x3,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[278],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[280],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[282],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[284],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[286],1,{[0][4]=0x1,[1][4]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[287],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[289],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[291],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[293],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[295],1,{[0][4]=0x1,[1][4]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[296],1,{[0][5]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[297],1,{[0][4]=0x1,[1][4]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[298],1,{[0][8]=0x1,[1][0]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[299],1,{[0][5]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[300],1,{[0][4]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[301],1,{[0][6]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[302],1,{[0][5]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[303],1,{[0][4]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[304],1,{[0][6]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[305],4,{[0][5]=0x9,[0][9]=0x2,[0][10]=0x4,[1][5]=0x8,[1][8]=0x7,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[309],4,{[0][4]=0x9,[0][9]=0x2,[0][10]=0x4,[1][5]=0x8,[1][8]=0x7,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[313],4,{[0][14]=0xf,[1][0]=0x1,[1][14]=0xe,[2][0]=0x3,[2][14]=0xc,[3][0]=0x7,[3][14]=0x8,}},
+	{&pdfmt[317],1,{[0][5]=0x1,[1][3]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[318],1,{[0][4]=0x1,[1][3]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[319],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[320],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[321],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[322],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[323],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[324],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[325],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[326],1,{[0][9]=0x1,[1][18]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[327],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[329],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[331],2,{[0][6]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[333],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[335],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[337],2,{[0][6]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[339],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[340],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[341],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[342],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[343],1,{[0][3]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[344],1,{[0][3]=0x1,[1][4]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[345],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[346],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[347],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[348],1,{[0][18]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[349],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[351],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[353],2,{[0][6]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[355],2,{[0][5]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[357],2,{[0][4]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[359],2,{[0][6]=0x3,[1][0]=0x1,[1][8]=0x2,[2][0]=0x3,[3][0]=0x3,}},
+	{&pdfmt[361],4,{[0][5]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[365],4,{[0][4]=0xf,[1][4]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[369],4,{[0][6]=0xf,[1][6]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[373],1,{[0][13]=0x1,[1][5]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[374],1,{[0][13]=0x1,[1][4]=0x1,[2][0]=0x1,[3][0]=0x1,}},
+	{&pdfmt[375],3,{[0][5]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[378],3,{[0][4]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[381],3,{[0][6]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[384],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[385],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[386],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[387],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[388],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[389],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[390],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[391],1,{[0][9]=0x1,[1][9]=0x1,[2][5]=0x1,[3][0]=0x1,}},
+	{&pdfmt[392],3,{[0][5]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[395],3,{[0][4]=0x1,[0][9]=0x2,[0][10]=0x4,[1][0]=0x7,[2][0]=0x7,[3][0]=0x7,}},
+	{&pdfmt[398],4,{[0][5]=0xf,[1][5]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+	{&pdfmt[402],4,{[0][4]=0xf,[1][4]=0x1,[1][8]=0x2,[1][9]=0x4,[1][10]=0x8,[2][0]=0xf,[3][0]=0xf,}},
+};
+
+struct	octab	pdoc[] = {
+	{&pdoc[96],(long)&pdidx[0],OTINS,0,"adc"},
+	{0,(long)&pdidx[0],OTINS,0,"ADC"},
+	{0,(long)&pdidx[1],OTINS,0,"adcb"},
+	{0,(long)&pdidx[1],OTINS,0,"ADCB"},
+	{0,(long)&pdidx[2],OTINS,0,"add"},
+	{0,(long)&pdidx[2],OTINS,0,"ADD"},
+	{0,(long)&pdidx[3],OTINS,0,"addb"},
+	{&pdoc[171],(long)&pdidx[3],OTINS,0,"ADDB"},
+	{0,(long)&pdidx[4],OTINS,0,"addl"},
+	{&pdoc[13],(long)&pdidx[4],OTINS,0,"ADDL"},
+	{&pdoc[188],(long)&pdidx[5],OTINS,0,"and"},
+	{&pdoc[261],(long)&pdidx[5],OTINS,0,"AND"},
+	{0,(long)&pdidx[6],OTINS,0,"andb"},
+	{&pdoc[76],(long)&pdidx[6],OTINS,0,"ANDB"},
+	{0,(long)&pdidx[7],OTINS,0,"bit"},
+	{&pdoc[152],(long)&pdidx[7],OTINS,0,"BIT"},
+	{0,(long)&pdidx[8],OTINS,0,"bitb"},
+	{0,(long)&pdidx[8],OTINS,0,"BITB"},
+	{&pdoc[228],(long)&pdidx[9],OTINS,0,"call"},
+	{&pdoc[170],(long)&pdidx[9],OTINS,0,"CALL"},
+	{0,(long)&pdidx[10],OTINS,0,"calr"},
+	{&pdoc[208],(long)&pdidx[10],OTINS,0,"CALR"},
+	{0,(long)&pdidx[11],OTINS,0,"clr"},
+	{0,(long)&pdidx[11],OTINS,0,"CLR"},
+	{&pdoc[338],(long)&pdidx[12],OTINS,0,"clrb"},
+	{&pdoc[174],(long)&pdidx[12],OTINS,0,"CLRB"},
+	{0,(long)&pdidx[13],OTINS,0,"com"},
+	{&pdoc[149],(long)&pdidx[13],OTINS,0,"COM"},
+	{&pdoc[94],(long)&pdidx[14],OTINS,0,"comb"},
+	{&pdoc[358],(long)&pdidx[14],OTINS,0,"COMB"},
+	{&pdoc[164],(long)&pdidx[15],OTINS,0,"comflg"},
+	{0,(long)&pdidx[15],OTINS,0,"COMFLG"},
+	{0,(long)&pdidx[16],OTINS,0,"cp"},
+	{&pdoc[131],(long)&pdidx[16],OTINS,0,"CP"},
+	{&pdoc[100],(long)&pdidx[17],OTINS,0,"cpb"},
+	{0,(long)&pdidx[17],OTINS,0,"CPB"},
+	{0,(long)&pdidx[18],OTINS,0,"cpl"},
+	{&pdoc[24],(long)&pdidx[18],OTINS,0,"CPL"},
+	{&pdoc[130],(long)&pdidx[19],OTINS,0,"cpd"},
+	{&pdoc[234],(long)&pdidx[19],OTINS,0,"CPD"},
+	{0,(long)&pdidx[20],OTINS,0,"cpdb"},
+	{0,(long)&pdidx[20],OTINS,0,"CPDB"},
+	{0,(long)&pdidx[21],OTINS,0,"cpdr"},
+	{0,(long)&pdidx[21],OTINS,0,"CPDR"},
+	{&pdoc[118],(long)&pdidx[22],OTINS,0,"cpdrb"},
+	{0,(long)&pdidx[22],OTINS,0,"CPDRB"},
+	{0,(long)&pdidx[23],OTINS,0,"cpi"},
+	{0,(long)&pdidx[23],OTINS,0,"CPI"},
+	{&pdoc[200],(long)&pdidx[24],OTINS,0,"cpib"},
+	{0,(long)&pdidx[24],OTINS,0,"CPIB"},
+	{0,(long)&pdidx[25],OTINS,0,"cpir"},
+	{&pdoc[221],(long)&pdidx[25],OTINS,0,"CPIR"},
+	{0,(long)&pdidx[26],OTINS,0,"cpirb"},
+	{&pdoc[163],(long)&pdidx[26],OTINS,0,"CPIRB"},
+	{0,(long)&pdidx[27],OTINS,0,"cpsd"},
+	{&pdoc[38],(long)&pdidx[27],OTINS,0,"CPSD"},
+	{0,(long)&pdidx[28],OTINS,0,"cpsdb"},
+	{&pdoc[205],(long)&pdidx[28],OTINS,0,"CPSDB"},
+	{0,(long)&pdidx[29],OTINS,0,"cpsdr"},
+	{&pdoc[124],(long)&pdidx[29],OTINS,0,"CPSDR"},
+	{0,(long)&pdidx[30],OTINS,0,"cpsdrb"},
+	{0,(long)&pdidx[30],OTINS,0,"CPSDRB"},
+	{0,(long)&pdidx[31],OTINS,0,"cpsi"},
+	{0,(long)&pdidx[31],OTINS,0,"CPSI"},
+	{0,(long)&pdidx[32],OTINS,0,"cpsib"},
+	{0,(long)&pdidx[32],OTINS,0,"CPSIB"},
+	{0,(long)&pdidx[33],OTINS,0,"cpsir"},
+	{0,(long)&pdidx[33],OTINS,0,"CPSIR"},
+	{0,(long)&pdidx[34],OTINS,0,"cpsirb"},
+	{0,(long)&pdidx[34],OTINS,0,"CPSIRB"},
+	{0,(long)&pdidx[35],OTINS,0,"dab"},
+	{&pdoc[331],(long)&pdidx[35],OTINS,0,"DAB"},
+	{0,(long)&pdidx[36],OTINS,0,"dec"},
+	{&pdoc[323],(long)&pdidx[36],OTINS,0,"DEC"},
+	{0,(long)&pdidx[37],OTINS,0,"decb"},
+	{&pdoc[329],(long)&pdidx[37],OTINS,0,"DECB"},
+	{&pdoc[260],(long)&pdidx[38],OTINS,0,"di"},
+	{&pdoc[132],(long)&pdidx[38],OTINS,0,"DI"},
+	{&pdoc[322],(long)&pdidx[39],OTINS,0,"div"},
+	{&pdoc[173],(long)&pdidx[39],OTINS,0,"DIV"},
+	{0,(long)&pdidx[40],OTINS,0,"divl"},
+	{&pdoc[216],(long)&pdidx[40],OTINS,0,"DIVL"},
+	{&pdoc[244],(long)&pdidx[41],OTINS,0,"djnz"},
+	{&pdoc[144],(long)&pdidx[41],OTINS,0,"DJNZ"},
+	{0,(long)&pdidx[42],OTINS,0,"dbjnz"},
+	{0,(long)&pdidx[42],OTINS,0,"DBJNZ"},
+	{0,(long)&pdidx[43],OTINS,0,"ei"},
+	{&pdoc[350],(long)&pdidx[43],OTINS,0,"EI"},
+	{0,(long)&pdidx[44],OTINS,0,"ex"},
+	{&pdoc[353],(long)&pdidx[44],OTINS,0,"EX"},
+	{0,(long)&pdidx[45],OTINS,0,"exb"},
+	{0,(long)&pdidx[45],OTINS,0,"EXB"},
+	{0,(long)&pdidx[46],OTINS,0,"exts"},
+	{0,(long)&pdidx[46],OTINS,0,"EXTS"},
+	{0,(long)&pdidx[47],OTINS,0,"extsb"},
+	{0,(long)&pdidx[47],OTINS,0,"EXTSB"},
+	{&pdoc[146],(long)&pdidx[48],OTINS,0,"extsl"},
+	{0,(long)&pdidx[48],OTINS,0,"EXTSL"},
+	{0,(long)&pdidx[49],OTINS,0,"halt"},
+	{0,(long)&pdidx[49],OTINS,0,"HALT"},
+	{0,(long)&pdidx[50],OTINS,0,"in"},
+	{&pdoc[211],(long)&pdidx[50],OTINS,0,"IN"},
+	{0,(long)&pdidx[51],OTINS,0,"inb"},
+	{0,(long)&pdidx[51],OTINS,0,"INB"},
+	{&pdoc[292],(long)&pdidx[52],OTINS,0,"inc"},
+	{&pdoc[135],(long)&pdidx[52],OTINS,0,"INC"},
+	{0,(long)&pdidx[53],OTINS,0,"incb"},
+	{&pdoc[307],(long)&pdidx[53],OTINS,0,"INCB"},
+	{0,(long)&pdidx[54],OTINS,0,"ind"},
+	{0,(long)&pdidx[54],OTINS,0,"IND"},
+	{&pdoc[356],(long)&pdidx[55],OTINS,0,"indb"},
+	{&pdoc[151],(long)&pdidx[55],OTINS,0,"INDB"},
+	{0,(long)&pdidx[56],OTINS,0,"indr"},
+	{0,(long)&pdidx[56],OTINS,0,"INDR"},
+	{0,(long)&pdidx[57],OTINS,0,"indrb"},
+	{&pdoc[297],(long)&pdidx[57],OTINS,0,"INDRB"},
+	{0,(long)&pdidx[58],OTINS,0,"ini"},
+	{0,(long)&pdidx[58],OTINS,0,"INI"},
+	{0,(long)&pdidx[59],OTINS,0,"inib"},
+	{0,(long)&pdidx[59],OTINS,0,"INIB"},
+	{&pdoc[288],(long)&pdidx[60],OTINS,0,"inir"},
+	{0,(long)&pdidx[60],OTINS,0,"INIR"},
+	{&pdoc[194],(long)&pdidx[61],OTINS,0,"inirb"},
+	{0,(long)&pdidx[61],OTINS,0,"INIRB"},
+	{0,(long)&pdidx[62],OTINS,0,"iret"},
+	{&pdoc[255],(long)&pdidx[62],OTINS,0,"IRET"},
+	{&pdoc[354],(long)&pdidx[63],OTINS,0,"jp"},
+	{0,(long)&pdidx[63],OTINS,0,"JP"},
+	{0,(long)&pdidx[64],OTINS,0,"jr"},
+	{&pdoc[363],(long)&pdidx[64],OTINS,0,"JR"},
+	{0,(long)&pdidx[65],OTINS,0,"ld"},
+	{0,(long)&pdidx[65],OTINS,0,"LD"},
+	{0,(long)&pdidx[66],OTINS,0,"ldb"},
+	{0,(long)&pdidx[66],OTINS,0,"LDB"},
+	{0,(long)&pdidx[67],OTINS,0,"ldl"},
+	{&pdoc[44],(long)&pdidx[67],OTINS,0,"LDL"},
+	{0,(long)&pdidx[68],OTINS,0,"lda"},
+	{0,(long)&pdidx[68],OTINS,0,"LDA"},
+	{0,(long)&pdidx[69],OTINS,0,"ldar"},
+	{&pdoc[352],(long)&pdidx[69],OTINS,0,"LDAR"},
+	{0,(long)&pdidx[70],OTINS,0,"ldctlb"},
+	{&pdoc[204],(long)&pdidx[70],OTINS,0,"LDCTLB"},
+	{&pdoc[256],(long)&pdidx[71],OTINS,0,"ldctl"},
+	{&pdoc[272],(long)&pdidx[71],OTINS,0,"LDCTL"},
+	{0,(long)&pdidx[72],OTINS,0,"ldd"},
+	{0,(long)&pdidx[72],OTINS,0,"LDD"},
+	{0,(long)&pdidx[73],OTINS,0,"lddb"},
+	{&pdoc[22],(long)&pdidx[73],OTINS,0,"LDDB"},
+	{0,(long)&pdidx[74],OTINS,0,"lddr"},
+	{0,(long)&pdidx[74],OTINS,0,"LDDR"},
+	{0,(long)&pdidx[75],OTINS,0,"lddrb"},
+	{&pdoc[279],(long)&pdidx[75],OTINS,0,"LDDRB"},
+	{0,(long)&pdidx[76],OTINS,0,"ldi"},
+	{0,(long)&pdidx[76],OTINS,0,"LDI"},
+	{0,(long)&pdidx[77],OTINS,0,"ldib"},
+	{&pdoc[274],(long)&pdidx[77],OTINS,0,"LDIB"},
+	{0,(long)&pdidx[78],OTINS,0,"ldir"},
+	{&pdoc[4],(long)&pdidx[78],OTINS,0,"LDIR"},
+	{0,(long)&pdidx[79],OTINS,0,"ldirb"},
+	{0,(long)&pdidx[79],OTINS,0,"LDIRB"},
+	{&pdoc[176],(long)&pdidx[80],OTINS,0,"ldk"},
+	{0,(long)&pdidx[80],OTINS,0,"LDK"},
+	{0,(long)&pdidx[81],OTINS,0,"ldm"},
+	{0,(long)&pdidx[81],OTINS,0,"LDM"},
+	{0,(long)&pdidx[82],OTINS,0,"ldps"},
+	{0,(long)&pdidx[82],OTINS,0,"LDPS"},
+	{&pdoc[190],(long)&pdidx[83],OTINS,0,"ldr"},
+	{0,(long)&pdidx[83],OTINS,0,"LDR"},
+	{0,(long)&pdidx[84],OTINS,0,"ldrb"},
+	{0,(long)&pdidx[84],OTINS,0,"LDRB"},
+	{0,(long)&pdidx[85],OTINS,0,"ldrl"},
+	{0,(long)&pdidx[85],OTINS,0,"LDRL"},
+	{0,(long)&pdidx[86],OTINS,0,"mbit"},
+	{&pdoc[362],(long)&pdidx[86],OTINS,0,"MBIT"},
+	{&pdoc[294],(long)&pdidx[87],OTINS,0,"mreq"},
+	{&pdoc[295],(long)&pdidx[87],OTINS,0,"MREQ"},
+	{0,(long)&pdidx[88],OTINS,0,"mres"},
+	{&pdoc[202],(long)&pdidx[88],OTINS,0,"MRES"},
+	{0,(long)&pdidx[89],OTINS,0,"mset"},
+	{0,(long)&pdidx[89],OTINS,0,"MSET"},
+	{&pdoc[222],(long)&pdidx[90],OTINS,0,"mult"},
+	{&pdoc[215],(long)&pdidx[90],OTINS,0,"MULT"},
+	{&pdoc[230],(long)&pdidx[91],OTINS,0,"multl"},
+	{0,(long)&pdidx[91],OTINS,0,"MULTL"},
+	{0,(long)&pdidx[92],OTINS,0,"neg"},
+	{0,(long)&pdidx[92],OTINS,0,"NEG"},
+	{0,(long)&pdidx[93],OTINS,0,"negb"},
+	{&pdoc[220],(long)&pdidx[93],OTINS,0,"NEGB"},
+	{0,(long)&pdidx[94],OTINS,0,"nop"},
+	{&pdoc[355],(long)&pdidx[94],OTINS,0,"NOP"},
+	{0,(long)&pdidx[95],OTINS,0,"or"},
+	{&pdoc[280],(long)&pdidx[95],OTINS,0,"OR"},
+	{&pdoc[330],(long)&pdidx[96],OTINS,0,"orb"},
+	{0,(long)&pdidx[96],OTINS,0,"ORB"},
+	{0,(long)&pdidx[97],OTINS,0,"otdr"},
+	{0,(long)&pdidx[97],OTINS,0,"OTDR"},
+	{0,(long)&pdidx[98],OTINS,0,"otdrb"},
+	{&pdoc[56],(long)&pdidx[98],OTINS,0,"OTDRB"},
+	{0,(long)&pdidx[99],OTINS,0,"otir"},
+	{&pdoc[106],(long)&pdidx[99],OTINS,0,"OTIR"},
+	{0,(long)&pdidx[100],OTINS,0,"otirb"},
+	{0,(long)&pdidx[100],OTINS,0,"OTIRB"},
+	{0,(long)&pdidx[101],OTINS,0,"out"},
+	{0,(long)&pdidx[101],OTINS,0,"OUT"},
+	{0,(long)&pdidx[102],OTINS,0,"outb"},
+	{0,(long)&pdidx[102],OTINS,0,"OUTB"},
+	{0,(long)&pdidx[103],OTINS,0,"outd"},
+	{0,(long)&pdidx[103],OTINS,0,"OUTD"},
+	{0,(long)&pdidx[104],OTINS,0,"outdb"},
+	{&pdoc[68],(long)&pdidx[104],OTINS,0,"OUTDB"},
+	{0,(long)&pdidx[105],OTINS,0,"outi"},
+	{0,(long)&pdidx[105],OTINS,0,"OUTI"},
+	{0,(long)&pdidx[106],OTINS,0,"outib"},
+	{&pdoc[293],(long)&pdidx[106],OTINS,0,"OUTIB"},
+	{&pdoc[298],(long)&pdidx[107],OTINS,0,"pop"},
+	{&pdoc[184],(long)&pdidx[107],OTINS,0,"POP"},
+	{0,(long)&pdidx[108],OTINS,0,"popl"},
+	{0,(long)&pdidx[108],OTINS,0,"POPL"},
+	{0,(long)&pdidx[109],OTINS,0,"push"},
+	{&pdoc[62],(long)&pdidx[109],OTINS,0,"PUSH"},
+	{0,(long)&pdidx[110],OTINS,0,"pushl"},
+	{0,(long)&pdidx[110],OTINS,0,"PUSHL"},
+	{&pdoc[304],(long)&pdidx[111],OTINS,0,"res"},
+	{0,(long)&pdidx[111],OTINS,0,"RES"},
+	{0,(long)&pdidx[112],OTINS,0,"resb"},
+	{&pdoc[104],(long)&pdidx[112],OTINS,0,"RESB"},
+	{&pdoc[334],(long)&pdidx[113],OTINS,0,"resflg"},
+	{0,(long)&pdidx[113],OTINS,0,"RESFLG"},
+	{0,(long)&pdidx[114],OTINS,0,"ret"},
+	{0,(long)&pdidx[114],OTINS,0,"RET"},
+	{0,(long)&pdidx[115],OTINS,0,"rl"},
+	{0,(long)&pdidx[115],OTINS,0,"RL"},
+	{0,(long)&pdidx[116],OTINS,0,"rlb"},
+	{0,(long)&pdidx[116],OTINS,0,"RLB"},
+	{0,(long)&pdidx[117],OTINS,0,"rlc"},
+	{0,(long)&pdidx[117],OTINS,0,"RLC"},
+	{0,(long)&pdidx[118],OTINS,0,"rlcb"},
+	{&pdoc[360],(long)&pdidx[118],OTINS,0,"RLCB"},
+	{0,(long)&pdidx[119],OTINS,0,"rldb"},
+	{&pdoc[178],(long)&pdidx[119],OTINS,0,"RLDB"},
+	{&pdoc[340],(long)&pdidx[120],OTINS,0,"rr"},
+	{0,(long)&pdidx[120],OTINS,0,"RR"},
+	{0,(long)&pdidx[121],OTINS,0,"rrb"},
+	{&pdoc[224],(long)&pdidx[121],OTINS,0,"RRB"},
+	{&pdoc[250],(long)&pdidx[122],OTINS,0,"rrc"},
+	{0,(long)&pdidx[122],OTINS,0,"RRC"},
+	{0,(long)&pdidx[123],OTINS,0,"rrcb"},
+	{0,(long)&pdidx[123],OTINS,0,"RRCB"},
+	{0,(long)&pdidx[124],OTINS,0,"rrdb"},
+	{&pdoc[311],(long)&pdidx[124],OTINS,0,"RRDB"},
+	{0,(long)&pdidx[125],OTINS,0,"sbc"},
+	{0,(long)&pdidx[125],OTINS,0,"SBC"},
+	{0,(long)&pdidx[126],OTINS,0,"sbcb"},
+	{&pdoc[14],(long)&pdidx[126],OTINS,0,"SBCB"},
+	{0,(long)&pdidx[127],OTINS,0,"sc"},
+	{&pdoc[86],(long)&pdidx[127],OTINS,0,"SC"},
+	{0,(long)&pdidx[128],OTINS,0,"sda"},
+	{&pdoc[114],(long)&pdidx[128],OTINS,0,"SDA"},
+	{0,(long)&pdidx[129],OTINS,0,"sdab"},
+	{0,(long)&pdidx[129],OTINS,0,"SDAB"},
+	{0,(long)&pdidx[130],OTINS,0,"sdal"},
+	{&pdoc[50],(long)&pdidx[130],OTINS,0,"SDAL"},
+	{&pdoc[286],(long)&pdidx[131],OTINS,0,"sdl"},
+	{0,(long)&pdidx[131],OTINS,0,"SDL"},
+	{0,(long)&pdidx[132],OTINS,0,"sdlb"},
+	{&pdoc[232],(long)&pdidx[132],OTINS,0,"SDLB"},
+	{0,(long)&pdidx[133],OTINS,0,"sdll"},
+	{&pdoc[122],(long)&pdidx[133],OTINS,0,"SDLL"},
+	{0,(long)&pdidx[134],OTINS,0,"set"},
+	{0,(long)&pdidx[134],OTINS,0,"SET"},
+	{0,(long)&pdidx[135],OTINS,0,"setb"},
+	{0,(long)&pdidx[135],OTINS,0,"SETB"},
+	{0,(long)&pdidx[136],OTINS,0,"setflg"},
+	{0,(long)&pdidx[136],OTINS,0,"SETFLG"},
+	{0,(long)&pdidx[137],OTINS,0,"sin"},
+	{0,(long)&pdidx[137],OTINS,0,"SIN"},
+	{0,(long)&pdidx[138],OTINS,0,"sinb"},
+	{&pdoc[74],(long)&pdidx[138],OTINS,0,"SINB"},
+	{0,(long)&pdidx[139],OTINS,0,"sind"},
+	{&pdoc[30],(long)&pdidx[139],OTINS,0,"SIND"},
+	{0,(long)&pdidx[140],OTINS,0,"sindb"},
+	{0,(long)&pdidx[140],OTINS,0,"SINDB"},
+	{0,(long)&pdidx[141],OTINS,0,"sindr"},
+	{0,(long)&pdidx[141],OTINS,0,"SINDR"},
+	{0,(long)&pdidx[142],OTINS,0,"sindrb"},
+	{0,(long)&pdidx[142],OTINS,0,"SINDRB"},
+	{0,(long)&pdidx[143],OTINS,0,"sini"},
+	{&pdoc[377],(long)&pdidx[143],OTINS,0,"SINI"},
+	{0,(long)&pdidx[144],OTINS,0,"sinib"},
+	{&pdoc[242],(long)&pdidx[144],OTINS,0,"SINIB"},
+	{0,(long)&pdidx[145],OTINS,0,"sinir"},
+	{&pdoc[344],(long)&pdidx[145],OTINS,0,"SINIR"},
+	{0,(long)&pdidx[146],OTINS,0,"sinirb"},
+	{&pdoc[327],(long)&pdidx[146],OTINS,0,"SINIRB"},
+	{0,(long)&pdidx[147],OTINS,0,"sla"},
+	{0,(long)&pdidx[147],OTINS,0,"SLA"},
+	{0,(long)&pdidx[148],OTINS,0,"slab"},
+	{&pdoc[376],(long)&pdidx[148],OTINS,0,"SLAB"},
+	{0,(long)&pdidx[149],OTINS,0,"slal"},
+	{&pdoc[70],(long)&pdidx[149],OTINS,0,"SLAL"},
+	{0,(long)&pdidx[150],OTINS,0,"sll"},
+	{0,(long)&pdidx[150],OTINS,0,"SLL"},
+	{0,(long)&pdidx[151],OTINS,0,"sllb"},
+	{&pdoc[312],(long)&pdidx[151],OTINS,0,"SLLB"},
+	{0,(long)&pdidx[152],OTINS,0,"slll"},
+	{0,(long)&pdidx[152],OTINS,0,"SLLL"},
+	{0,(long)&pdidx[153],OTINS,0,"sotdr"},
+	{0,(long)&pdidx[153],OTINS,0,"SOTDR"},
+	{0,(long)&pdidx[154],OTINS,0,"sotdrb"},
+	{0,(long)&pdidx[154],OTINS,0,"SOTDRB"},
+	{0,(long)&pdidx[155],OTINS,0,"sotir"},
+	{&pdoc[336],(long)&pdidx[155],OTINS,0,"SOTIR"},
+	{0,(long)&pdidx[156],OTINS,0,"sotirb"},
+	{0,(long)&pdidx[156],OTINS,0,"SOTIRB"},
+	{0,(long)&pdidx[157],OTINS,0,"sout"},
+	{0,(long)&pdidx[157],OTINS,0,"SOUT"},
+	{0,(long)&pdidx[158],OTINS,0,"soutb"},
+	{0,(long)&pdidx[158],OTINS,0,"SOUTB"},
+	{0,(long)&pdidx[159],OTINS,0,"soutd"},
+	{0,(long)&pdidx[159],OTINS,0,"SOUTD"},
+	{0,(long)&pdidx[160],OTINS,0,"soutdb"},
+	{0,(long)&pdidx[160],OTINS,0,"SOUTDB"},
+	{0,(long)&pdidx[161],OTINS,0,"souti"},
+	{0,(long)&pdidx[161],OTINS,0,"SOUTI"},
+	{0,(long)&pdidx[162],OTINS,0,"soutib"},
+	{0,(long)&pdidx[162],OTINS,0,"SOUTIB"},
+	{0,(long)&pdidx[163],OTINS,0,"sra"},
+	{0,(long)&pdidx[163],OTINS,0,"SRA"},
+	{0,(long)&pdidx[164],OTINS,0,"srab"},
+	{0,(long)&pdidx[164],OTINS,0,"SRAB"},
+	{0,(long)&pdidx[165],OTINS,0,"sral"},
+	{&pdoc[367],(long)&pdidx[165],OTINS,0,"SRAL"},
+	{0,(long)&pdidx[166],OTINS,0,"srl"},
+	{0,(long)&pdidx[166],OTINS,0,"SRL"},
+	{0,(long)&pdidx[167],OTINS,0,"srlb"},
+	{0,(long)&pdidx[167],OTINS,0,"SRLB"},
+	{0,(long)&pdidx[168],OTINS,0,"srll"},
+	{0,(long)&pdidx[168],OTINS,0,"SRLL"},
+	{0,(long)&pdidx[169],OTINS,0,"sub"},
+	{&pdoc[162],(long)&pdidx[169],OTINS,0,"SUB"},
+	{0,(long)&pdidx[170],OTINS,0,"subb"},
+	{0,(long)&pdidx[170],OTINS,0,"SUBB"},
+	{0,(long)&pdidx[171],OTINS,0,"subl"},
+	{0,(long)&pdidx[171],OTINS,0,"SUBL"},
+	{0,(long)&pdidx[172],OTINS,0,"tcc"},
+	{0,(long)&pdidx[172],OTINS,0,"TCC"},
+	{0,(long)&pdidx[173],OTINS,0,"tccb"},
+	{&pdoc[116],(long)&pdidx[173],OTINS,0,"TCCB"},
+	{0,(long)&pdidx[174],OTINS,0,"test"},
+	{0,(long)&pdidx[174],OTINS,0,"TEST"},
+	{0,(long)&pdidx[175],OTINS,0,"testb"},
+	{&pdoc[78],(long)&pdidx[175],OTINS,0,"TESTB"},
+	{0,(long)&pdidx[176],OTINS,0,"testl"},
+	{0,(long)&pdidx[176],OTINS,0,"TESTL"},
+	{0,(long)&pdidx[177],OTINS,0,"trdb"},
+	{&pdoc[166],(long)&pdidx[177],OTINS,0,"TRDB"},
+	{0,(long)&pdidx[178],OTINS,0,"trdrb"},
+	{0,(long)&pdidx[178],OTINS,0,"TRDRB"},
+	{0,(long)&pdidx[179],OTINS,0,"trib"},
+	{0,(long)&pdidx[179],OTINS,0,"TRIB"},
+	{0,(long)&pdidx[180],OTINS,0,"trirb"},
+	{0,(long)&pdidx[180],OTINS,0,"TRIRB"},
+	{0,(long)&pdidx[181],OTINS,0,"trtdb"},
+	{0,(long)&pdidx[181],OTINS,0,"TRTDB"},
+	{0,(long)&pdidx[182],OTINS,0,"trtdrb"},
+	{0,(long)&pdidx[182],OTINS,0,"TRTDRB"},
+	{0,(long)&pdidx[183],OTINS,0,"trtib"},
+	{0,(long)&pdidx[183],OTINS,0,"TRTIB"},
+	{0,(long)&pdidx[184],OTINS,0,"trtirb"},
+	{0,(long)&pdidx[184],OTINS,0,"TRTIRB"},
+	{0,(long)&pdidx[185],OTINS,0,"tset"},
+	{0,(long)&pdidx[185],OTINS,0,"TSET"},
+	{0,(long)&pdidx[186],OTINS,0,"tsetb"},
+	{0,(long)&pdidx[186],OTINS,0,"TSETB"},
+	{0,(long)&pdidx[187],OTINS,0,"xor"},
+	{0,(long)&pdidx[187],OTINS,0,"XOR"},
+	{0,(long)&pdidx[188],OTINS,0,"xorb"},
+	{&pdoc[32],(long)&pdidx[188],OTINS,0,"XORB"},
+	{&pdoc[108],1,OTDIR,0,".end"},
+	{0,1,OTDIR,0,".END"},
+	{&pdoc[269],2,OTDIR,0,".equ"},
+	{&pdoc[187],2,OTDIR,0,".EQU"},
+	{0,3,OTDIR,0,".input"},
+	{&pdoc[88],3,OTDIR,0,".INPUT"},
+	{&pdoc[364],4,OTDIR,0,".byte"},
+	{&pdoc[389],4,OTDIR,0,".BYTE"},
+	{&pdoc[112],5,OTDIR,0,".word"},
+	{0,5,OTDIR,0,".WORD"},
+	{&pdoc[246],6,OTDIR,0,".set"},
+	{&pdoc[37],6,OTDIR,0,".SET"},
+	{&pdoc[420],7,OTDIR,0,".block"},
+	{0,7,OTDIR,0,".BLOCK"},
+	{0,8,OTDIR,0,".org"},
+	{&pdoc[67],8,OTDIR,0,".ORG"},
+	{0,9,OTDIR,0,".clist"},
+	{&pdoc[410],9,OTDIR,0,".CLIST"},
+	{&pdoc[41],10,OTDIR,0,".sect"},
+	{&pdoc[16],10,OTDIR,0,".SECT"},
+	{&pdoc[335],11,OTDIR,0,".space"},
+	{0,11,OTDIR,0,".SPACE"},
+	{0,12,OTDIR,0,".stitle"},
+	{&pdoc[75],12,OTDIR,0,".STITLE"},
+	{0,13,OTDIR,0,".title"},
+	{&pdoc[195],13,OTDIR,0,".TITLE"},
+	{&pdoc[150],14,OTDIR,0,".list"},
+	{&pdoc[186],14,OTDIR,0,".LIST"},
+	{&pdoc[71],15,OTDIR,0,".else"},
+	{&pdoc[217],15,OTDIR,0,".ELSE"},
+	{0,16,OTDIR,0,".endif"},
+	{&pdoc[324],16,OTDIR,0,".ENDIF"},
+	{0,17,OTDIR,0,".if"},
+	{&pdoc[332],17,OTDIR,0,".IF"},
+	{0,18,OTDIR,0,".global"},
+	{0,18,OTDIR,0,".GLOBAL"},
+	{&pdoc[109],19,OTDIR,0,".abs"},
+	{0,19,OTDIR,0,".ABS"},
+	{&pdoc[342],20,OTDIR,0,".align"},
+	{&pdoc[203],20,OTDIR,0,".ALIGN"},
+	{&pdoc[365],21,OTDIR,0,".within"},
+	{&pdoc[281],21,OTDIR,0,".WITHIN"},
+	{&pdoc[319],22,OTDIR,0,".macro"},
+	{&pdoc[6],22,OTDIR,0,".MACRO"},
+	{0,23,OTDIR,0,".endm"},
+	{&pdoc[301],23,OTDIR,0,".ENDM"},
+	{&pdoc[92],24,OTDIR,0,".long"},
+	{&pdoc[283],24,OTDIR,0,".LONG"},
+	{&pdoc[158],25,OTDIR,0,".eject"},
+	{&pdoc[425],25,OTDIR,0,".EJECT"},
+	{0,26,OTDIR,0,".common"},
+	{&pdoc[253],26,OTDIR,0,".COMMON"},
+	{&pdoc[199],28,OTDIR,0,".endr"},
+	{0,28,OTDIR,0,".ENDR"},
+	{0,29,OTDIR,0,".repeat"},
+	{&pdoc[180],29,OTDIR,0,".REPEAT"},
+	{&pdoc[101],30,OTDIR,0,".error"},
+	{0,30,OTDIR,0,".ERROR"},
+	{0,31,OTDIR,0,".exit"},
+	{&pdoc[309],31,OTDIR,0,".EXIT"},
+	{&pdoc[1],33,OTDIR,0,".warn"},
+	{0,33,OTDIR,0,".WARN"},
+};
+
+struct	octab	*pdoch[1<<OHSHLOG] = {
+	&pdoc[412],
+	&pdoc[328],
+	&pdoc[396],
+	&pdoc[333],
+	0,
+	0,
+	&pdoc[60],
+	0,
+	0,
+	0,
+	&pdoc[325],
+	0,
+	0,
+	0,
+	&pdoc[3],
+	&pdoc[192],
+	0,
+	0,
+	&pdoc[409],
+	0,
+	0,
+	&pdoc[403],
+	0,
+	&pdoc[53],
+	&pdoc[375],
+	&pdoc[238],
+	&pdoc[237],
+	&pdoc[289],
+	&pdoc[387],
+	&pdoc[69],
+	0,
+	0,
+	0,
+	0,
+	&pdoc[212],
+	&pdoc[341],
+	0,
+	&pdoc[266],
+	0,
+	0,
+	&pdoc[35],
+	&pdoc[251],
+	&pdoc[351],
+	0,
+	&pdoc[183],
+	&pdoc[296],
+	&pdoc[259],
+	&pdoc[182],
+	&pdoc[159],
+	&pdoc[12],
+	&pdoc[23],
+	0,
+	&pdoc[21],
+	&pdoc[348],
+	&pdoc[117],
+	0,
+	0,
+	&pdoc[136],
+	0,
+	&pdoc[201],
+	&pdoc[347],
+	0,
+	&pdoc[110],
+	0,
+	0,
+	0,
+	0,
+	&pdoc[93],
+	&pdoc[98],
+	0,
+	&pdoc[143],
+	&pdoc[227],
+	0,
+	0,
+	0,
+	0,
+	&pdoc[235],
+	&pdoc[431],
+	0,
+	0,
+	0,
+	0,
+	&pdoc[383],
+	0,
+	&pdoc[120],
+	&pdoc[84],
+	&pdoc[419],
+	&pdoc[345],
+	&pdoc[197],
+	&pdoc[278],
+	0,
+	0,
+	0,
+	&pdoc[346],
+	0,
+	0,
+	&pdoc[77],
+	&pdoc[95],
+	&pdoc[52],
+	&pdoc[175],
+	0,
+	0,
+	0,
+	&pdoc[378],
+	0,
+	&pdoc[373],
+	0,
+	0,
+	&pdoc[154],
+	&pdoc[414],
+	&pdoc[134],
+	0,
+	0,
+	&pdoc[240],
+	&pdoc[368],
+	0,
+	&pdoc[397],
+	&pdoc[421],
+	0,
+	&pdoc[46],
+	&pdoc[47],
+	&pdoc[277],
+	&pdoc[165],
+	&pdoc[267],
+	&pdoc[258],
+	&pdoc[155],
+	0,
+	0,
+	&pdoc[42],
+	0,
+	&pdoc[123],
+	0,
+	&pdoc[66],
+	&pdoc[263],
+	0,
+	0,
+	0,
+	&pdoc[139],
+	&pdoc[300],
+	0,
+	&pdoc[55],
+	&pdoc[437],
+	0,
+	&pdoc[160],
+	0,
+	0,
+	&pdoc[314],
+	&pdoc[299],
+	0,
+	&pdoc[207],
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	&pdoc[310],
+	0,
+	&pdoc[413],
+	&pdoc[366],
+	&pdoc[11],
+	&pdoc[241],
+	&pdoc[128],
+	&pdoc[59],
+	&pdoc[105],
+	0,
+	&pdoc[284],
+	0,
+	&pdoc[147],
+	0,
+	&pdoc[133],
+	0,
+	&pdoc[129],
+	&pdoc[198],
+	&pdoc[225],
+	&pdoc[287],
+	&pdoc[189],
+	&pdoc[318],
+	&pdoc[218],
+	0,
+	&pdoc[361],
+	0,
+	0,
+	0,
+	&pdoc[113],
+	&pdoc[219],
+	&pdoc[400],
+	&pdoc[399],
+	0,
+	&pdoc[172],
+	0,
+	0,
+	0,
+	&pdoc[315],
+	&pdoc[39],
+	&pdoc[273],
+	&pdoc[89],
+	0,
+	&pdoc[20],
+	0,
+	&pdoc[337],
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	&pdoc[226],
+	&pdoc[392],
+	0,
+	&pdoc[313],
+	&pdoc[51],
+	&pdoc[432],
+	0,
+	0,
+	&pdoc[257],
+	&pdoc[0],
+	0,
+	0,
+	&pdoc[153],
+	0,
+	&pdoc[115],
+	0,
+	&pdoc[33],
+	&pdoc[191],
+	0,
+	0,
+	&pdoc[214],
+	0,
+	0,
+	0,
+	&pdoc[308],
+	0,
+	&pdoc[408],
+	0,
+	0,
+	&pdoc[82],
+	&pdoc[2],
+	0,
+	&pdoc[371],
+	&pdoc[31],
+	0,
+	&pdoc[9],
+	0,
+	&pdoc[402],
+	0,
+	&pdoc[83],
+	&pdoc[405],
+	0,
+	0,
+	&pdoc[429],
+	0,
+	0,
+	0,
+	&pdoc[231],
+	&pdoc[430],
+	0,
+	&pdoc[404],
+	&pdoc[229],
+	0,
+	0,
+	&pdoc[394],
+	0,
+	0,
+	&pdoc[285],
+	&pdoc[61],
+	0,
+	&pdoc[252],
+	&pdoc[426],
+	&pdoc[343],
+	&pdoc[386],
+	&pdoc[264],
+	0,
+	&pdoc[119],
+	0,
+	&pdoc[271],
+	&pdoc[36],
+	&pdoc[374],
+	0,
+	&pdoc[103],
+	0,
+	0,
+	0,
+	0,
+	&pdoc[243],
+	&pdoc[339],
+	&pdoc[179],
+	&pdoc[8],
+	&pdoc[379],
+	0,
+	&pdoc[398],
+	&pdoc[91],
+	&pdoc[268],
+	0,
+	&pdoc[427],
+	&pdoc[275],
+	0,
+	&pdoc[372],
+	&pdoc[99],
+	&pdoc[81],
+	&pdoc[107],
+	&pdoc[142],
+	0,
+	&pdoc[276],
+	0,
+	0,
+	&pdoc[349],
+	0,
+	&pdoc[438],
+	&pdoc[424],
+	0,
+	&pdoc[401],
+	&pdoc[382],
+	&pdoc[406],
+	0,
+	&pdoc[209],
+	&pdoc[145],
+	0,
+	0,
+	&pdoc[85],
+	0,
+	&pdoc[210],
+	0,
+	0,
+	&pdoc[141],
+	&pdoc[177],
+	0,
+	0,
+	&pdoc[126],
+	0,
+	0,
+	&pdoc[439],
+	0,
+	&pdoc[157],
+	0,
+	&pdoc[97],
+	0,
+	&pdoc[265],
+	&pdoc[196],
+	&pdoc[26],
+	0,
+	&pdoc[306],
+	0,
+	0,
+	&pdoc[18],
+	0,
+	0,
+	&pdoc[385],
+	&pdoc[156],
+	&pdoc[102],
+	0,
+	&pdoc[416],
+	&pdoc[29],
+	&pdoc[254],
+	0,
+	0,
+	&pdoc[290],
+	0,
+	&pdoc[390],
+	0,
+	&pdoc[239],
+	0,
+	0,
+	0,
+	&pdoc[370],
+	0,
+	&pdoc[393],
+	0,
+	&pdoc[48],
+	&pdoc[79],
+	&pdoc[43],
+	&pdoc[137],
+	0,
+	0,
+	&pdoc[248],
+	0,
+	&pdoc[395],
+	0,
+	0,
+	0,
+	0,
+	&pdoc[140],
+	&pdoc[262],
+	0,
+	&pdoc[423],
+	0,
+	0,
+	&pdoc[49],
+	0,
+	&pdoc[161],
+	0,
+	0,
+	&pdoc[111],
+	&pdoc[58],
+	&pdoc[72],
+	&pdoc[321],
+	&pdoc[317],
+	&pdoc[391],
+	0,
+	&pdoc[10],
+	0,
+	&pdoc[388],
+	&pdoc[45],
+	&pdoc[320],
+	0,
+	0,
+	&pdoc[169],
+	0,
+	&pdoc[7],
+	&pdoc[27],
+	&pdoc[54],
+	&pdoc[316],
+	0,
+	0,
+	&pdoc[65],
+	&pdoc[326],
+	0,
+	&pdoc[5],
+	&pdoc[206],
+	&pdoc[247],
+	&pdoc[168],
+	&pdoc[249],
+	&pdoc[34],
+	&pdoc[87],
+	&pdoc[415],
+	&pdoc[25],
+	&pdoc[19],
+	&pdoc[245],
+	0,
+	0,
+	0,
+	&pdoc[63],
+	0,
+	&pdoc[125],
+	&pdoc[422],
+	0,
+	&pdoc[64],
+	&pdoc[185],
+	&pdoc[28],
+	0,
+	&pdoc[90],
+	0,
+	0,
+	0,
+	0,
+	0,
+	0,
+	&pdoc[357],
+	&pdoc[17],
+	0,
+	&pdoc[369],
+	&pdoc[270],
+	0,
+	0,
+	&pdoc[127],
+	0,
+	&pdoc[411],
+	&pdoc[359],
+	&pdoc[193],
+	&pdoc[417],
+	0,
+	&pdoc[236],
+	0,
+	&pdoc[407],
+	&pdoc[282],
+	&pdoc[15],
+	0,
+	0,
+	0,
+	&pdoc[213],
+	0,
+	0,
+	&pdoc[181],
+	0,
+	0,
+	0,
+	&pdoc[436],
+	0,
+	0,
+	&pdoc[233],
+	0,
+	&pdoc[121],
+	&pdoc[380],
+	&pdoc[418],
+	&pdoc[428],
+	0,
+	0,
+	&pdoc[302],
+	0,
+	&pdoc[148],
+	0,
+	&pdoc[291],
+	&pdoc[381],
+	&pdoc[433],
+	0,
+	&pdoc[384],
+	&pdoc[40],
+	0,
+	&pdoc[305],
+	&pdoc[57],
+	0,
+	0,
+	&pdoc[434],
+	&pdoc[223],
+	&pdoc[303],
+	0,
+	&pdoc[167],
+	&pdoc[138],
+	&pdoc[435],
+	&pdoc[73],
+	0,
+	&pdoc[80],
+};
+struct	octab	**ochtab = pdoch;
+uns		ochsiz = 1<<OHSHLOG;
+uns		occt = 440;
+
+struct	pdsym	pdsym[] = {
+	{"$",0x100},
+	{"rh0",0x1000},
+	{"RH0",0x1000},
+	{"rh1",0x1001},
+	{"RH1",0x1001},
+	{"rh2",0x1002},
+	{"RH2",0x1002},
+	{"rh3",0x1003},
+	{"RH3",0x1003},
+	{"rh4",0x1004},
+	{"RH4",0x1004},
+	{"rh5",0x1005},
+	{"RH5",0x1005},
+	{"rh6",0x1006},
+	{"RH6",0x1006},
+	{"rh7",0x1007},
+	{"RH7",0x1007},
+	{"rl0",0x1008},
+	{"RL0",0x1008},
+	{"rl1",0x1009},
+	{"RL1",0x1009},
+	{"rl2",0x100a},
+	{"RL2",0x100a},
+	{"rl3",0x100b},
+	{"RL3",0x100b},
+	{"rl4",0x100c},
+	{"RL4",0x100c},
+	{"rl5",0x100d},
+	{"RL5",0x100d},
+	{"rl6",0x100e},
+	{"RL6",0x100e},
+	{"rl7",0x100f},
+	{"RL7",0x100f},
+	{"r0",0x1100},
+	{"R0",0x1100},
+	{"r1",0x1101},
+	{"R1",0x1101},
+	{"r2",0x1102},
+	{"R2",0x1102},
+	{"r3",0x1103},
+	{"R3",0x1103},
+	{"r4",0x1104},
+	{"R4",0x1104},
+	{"r5",0x1105},
+	{"R5",0x1105},
+	{"r6",0x1106},
+	{"R6",0x1106},
+	{"r7",0x1107},
+	{"R7",0x1107},
+	{"r8",0x1108},
+	{"R8",0x1108},
+	{"r9",0x1109},
+	{"R9",0x1109},
+	{"r10",0x110a},
+	{"R10",0x110a},
+	{"r11",0x110b},
+	{"R11",0x110b},
+	{"r12",0x110c},
+	{"R12",0x110c},
+	{"r13",0x110d},
+	{"R13",0x110d},
+	{"r14",0x110e},
+	{"R14",0x110e},
+	{"r15",0x110f},
+	{"R15",0x110f},
+	{"rr0",0x1200},
+	{"RR0",0x1200},
+	{"rr2",0x1202},
+	{"RR2",0x1202},
+	{"rr4",0x1204},
+	{"RR4",0x1204},
+	{"rr6",0x1206},
+	{"RR6",0x1206},
+	{"rr8",0x1208},
+	{"RR8",0x1208},
+	{"rr10",0x120a},
+	{"RR10",0x120a},
+	{"rr12",0x120c},
+	{"RR12",0x120c},
+	{"rr14",0x120e},
+	{"RR14",0x120e},
+	{"rq0",0x1300},
+	{"RQ0",0x1300},
+	{"rq4",0x1304},
+	{"RQ4",0x1304},
+	{"rq8",0x1308},
+	{"RQ8",0x1308},
+	{"rq12",0x130c},
+	{"RQ12",0x130c},
+	{"lt",0x1401},
+	{"LT",0x1401},
+	{"le",0x1402},
+	{"LE",0x1402},
+	{"ule",0x1403},
+	{"ULE",0x1403},
+	{"ov",0x1404},
+	{"OV",0x1404},
+	{"pe",0x1404},
+	{"PE",0x1404},
+	{"p",0x1404},
+	{"P",0x1404},
+	{"v",0x1404},
+	{"V",0x1404},
+	{"mi",0x1405},
+	{"MI",0x1405},
+	{"s",0x1405},
+	{"S",0x1405},
+	{"z",0x1406},
+	{"Z",0x1406},
+	{"eq",0x1406},
+	{"EQ",0x1406},
+	{"c",0x1407},
+	{"C",0x1407},
+	{"ult",0x1407},
+	{"ULT",0x1407},
+	{"ge",0x1409},
+	{"GE",0x1409},
+	{"gt",0x140a},
+	{"GT",0x140a},
+	{"ugt",0x140b},
+	{"UGT",0x140b},
+	{"nov",0x140c},
+	{"NOV",0x140c},
+	{"po",0x140c},
+	{"PO",0x140c},
+	{"pl",0x140d},
+	{"PL",0x140d},
+	{"nz",0x140e},
+	{"NZ",0x140e},
+	{"ne",0x140e},
+	{"NE",0x140e},
+	{"nc",0x140f},
+	{"NC",0x140f},
+	{"uge",0x140f},
+	{"UGE",0x140f},
+	{"nvi",0x150e},
+	{"NVI",0x150e},
+	{"vi",0x150d},
+	{"VI",0x150d},
+	{"fcw",0x1602},
+	{"FCW",0x1602},
+	{"refresh",0x1603},
+	{"REFRESH",0x1603},
+	{"psapseg",0x1604},
+	{"PSAPSEG",0x1604},
+	{"psapoff",0x1605},
+	{"PSAPOFF",0x1605},
+	{"psap",0x1605},
+	{"PSAP",0x1605},
+	{"nspseg",0x1606},
+	{"NSPSEG",0x1606},
+	{"nspoff",0x1607},
+	{"NSPOFF",0x1607},
+	{"nsp",0x1607},
+	{"NSP",0x1607},
+	{"flags",0x1701},
+	{"FLAGS",0x1701},
+	{0}
+};
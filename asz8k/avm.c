@@ -1,52 +1,46 @@
 #include <stdio.h>
-#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
 /*
  * Changed to use the Standard I/O library  9/13/82  FZ
  */
 #include "acom.h"
 
-static	char	ident[] = "@(#)a.vm.c	3.1";
+static	char	ident[] = "@(#)a.vm.c	3.2";
 
 /*
- * getbuf - Returns a pointer to a buffer which contains the specified
- * virtual address.  Pages the buffers on a LRU basis.
+ * The virtual memory lives in core, in chunks of 1<<CHKLOG bytes which
+ * are allocated as they are first touched.  vmchk points to the chunks;
+ * it grows as needed, but the chunks themselves never move, so pointers
+ * returned by rfetch and wfetch stay good.
  */
-struct vmbuf *
-getbuf(adr) vmadr adr; {
+char	**vmchk;		/* the chunks, by number */
+uns	vmnchk;			/* number of entries in vmchk */
 
-static int limblk = 0;			/* file high water mark */
-reg struct vmbuf *cb, *pb;
-reg uns vbn;
+/*
+ * getadr - Returns a pointer to the in-core copy of the specified
+ * virtual address.
+ */
+char *
+getadr(adr) vmadr adr; {
+
+reg uns cn, n;
 
-#ifdef	STATS
 	vmgct++;
-#endif
-	vbn = adr>>BLKLOG;
-	pb = &vmhead;  cb = vmhead;
-	while(cb->vm_blk!=vbn && cb->vm_lnk) {
-		pb = cb;  cb = cb->vm_lnk;
+	cn = adr>>CHKLOG;
+	if(cn >= vmnchk) {
+		n = vmnchk ? vmnchk : 16;
+		while(n <= cn) n *= 2;
+		if((vmchk = realloc(vmchk,n*sizeof(char *))) == 0) goto nomem;
+		memset(vmchk+vmnchk,0,(n-vmnchk)*sizeof(char *));
+		vmnchk = n;
 	}
-	if(cb->vm_blk!=vbn) { /* must commandeer a buffer */
-		if(cb->vm_flg&VMDIR) { /* write out old contents */
-			lseek(vmfd,(long)cb->vm_blk<<BLKLOG,0);
-			write(vmfd,cb->vm_mem,1<<BLKLOG);
-			if(cb->vm_blk >= limblk) limblk = cb->vm_blk+1;
-			cb->vm_flg &= ~VMDIR;
-#ifdef	STATS
-			vmwct++;
-#endif
-		}
-		if(vbn < limblk) {  /* read from disk */
-			lseek(vmfd,(long)vbn<<BLKLOG,0);
-			read(vmfd,cb->vm_mem,1<<BLKLOG);
-#ifdef	STATS
-			vmrct++;
-#endif
-		}
-		cb->vm_blk = vbn;
-	}
-	pb->vm_lnk = cb->vm_lnk;  cb->vm_lnk = vmhead;  vmhead = cb;
-	return(cb);
+	if(vmchk[cn] == 0 && (vmchk[cn] = calloc(1,1<<CHKLOG)) == 0)
+		goto nomem;
+	return(&vmchk[cn][adr&(1<<CHKLOG)-1]);
+nomem:
+	fprintf(ERROR,"Out of memory for symbols and macros\n");
+	exit(1);
 }
 
 /*
@@ -56,7 +50,7 @@ reg uns vbn;
 char *
 rfetch(adr) vmadr adr; {
 
-	return(&getbuf(adr)->vm_mem[adr&(1<<BLKLOG)-1]);
+	return(getadr(adr));
 }
 
 /*
@@ -76,15 +70,11 @@ vmadr	base, blklim;
 }
 
 /*
- * vinit - Opens the virtual memory file.
+ * vinit - Initializes the virtual memory.
  */
 vinit() {
 
-	close(creatb("VM.TMP",0666));
-	if((vmfd=openb("VM.TMP",2)) == -1) {
-		fprintf(ERROR,"Cannot reopen vm file\n");
-		exit(1);
-	}
+	getadr((vmadr)0);
 }
 
 /*
@@ -94,8 +84,5 @@ vinit() {
 char *
 wfetch(adr) vmadr adr; {
 
-reg struct vmbuf *bp;
-
-	(bp=getbuf(adr))->vm_flg |= VMDIR;
-	return(&bp->vm_mem[adr&(1<<BLKLOG)-1]);
+	return(getadr(adr));
 }
@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "acom.h"
+#include "obj.h"
+#include "xout.h"
+
+/*
+ * x.out output for -X.  The object blocks that oflush() builds are kept
+ * in memory instead of going to the .obj file, and xout() turns them
+ * into an x.out file the same way xcon turns a .obj file into one.
+ */
+static	char	ident[] = "@(#)a.xout.c	1.0";
+
+#define	EXTMAX	(RBMSK+1-RBEXT)	/* maximum number of external symbols */
+
+extern	char	segflg;
+extern	char	oflag;
+extern	char	optfile[];
+
+char	*xobuf;			/* the object blocks */
+long	xolen;			/* bytes in xobuf */
+long	xomax;			/* room in xobuf */
+
+struct	xosym {			/* a symbol, as the object blocks give it */
+	char	*xs_str;
+	char	xs_typ;
+	uns	xs_val;
+	uns	xs_sec;
+};
+struct	xorel {			/* a relocation entry, likewise */
+	char	xr_typ;
+	uns	xr_loc;
+	uns	xr_sec;
+	uns	xr_bas;
+};
+struct	xotxt {			/* a text block, still in xobuf */
+	char	*xt_ptr;
+	uns	xt_loc;
+	uns	xt_sec;
+	uns	xt_len;
+};
+
+struct	x_sg	xoseg[SECSIZ+1];	/* the segments, as xcon numbers them */
+int		xonseg;
+uns		xoext[EXTMAX];		/* symbol number of each external */
+int		xonext;
+struct	xosym	*xosym;
+struct	xorel	*xorel;
+struct	xotxt	*xotxt;
+int		xonsym, xonrel, xontxt;
+int		xomsym, xomrel, xomtxt;
+
+char	*xoimg;			/* the x.out file */
+char	*xopt;			/* next byte of it to fill */
+
+char	*xoadd();
+
+/*
+ * oputc - Puts a byte of an object block out, into the object file or
+ * for -X into xobuf.
+ */
+oputc(c) int c; {
+
+	if(!xoflag) {
+		fputc(c,OBJECT);
+		return;
+	}
+	if(xolen >= xomax) {
+		xomax = xomax ? 2*xomax : 4096;
+		if((xobuf = realloc(xobuf,xomax)) == NULL) {
+			fprintf(ERROR,"Out of memory for x.out\n");
+			exit(1);
+		}
+	}
+	xobuf[xolen++] = c;
+}
+
+/*
+ * xoadd - Makes room for one more entry in a table, and returns a
+ * pointer to it.
+ */
+char *
+xoadd(tabp,ctp,maxp,size) char **tabp; int *ctp; int *maxp; int size; {
+
+	if(*ctp >= *maxp) {
+		*maxp = *maxp ? 2 * *maxp : 64;
+		if((*tabp = realloc(*tabp,(long)*maxp*size)) == NULL) {
+			fprintf(ERROR,"Out of memory for x.out\n");
+			exit(1);
+		}
+	}
+	return(*tabp + (long)(*ctp)++ * size);
+}
+
+/*
+ * xob - Puts a byte into the x.out file.
+ */
+xob(c) int c; {
+
+	*xopt++ = c;
+}
+
+/*
+ * xow - Puts a word into the x.out file, most significant byte first.
+ */
+xow(w) uns w; {
+
+	xob(w>>8);
+	xob(w);
+}
+
+/*
+ * xout - Makes the x.out file from the object blocks in xobuf.
+ */
+xout() {
+
+reg	char	*p;
+char	*top;
+char	*name;
+struct	xosym	*sp;
+struct	xorel	*rp;
+struct	xotxt	*tp;
+uns	typ, len, sec, loc, ent, act, bas;
+int	i, fd, magic;
+long	off, init, segoff[SECSIZ+1], reloff, size;
+
+	magic = segflg ? X_SU_MAGIC : X_NU_MAGIC;
+	xoseg[0].x_sg_typ = X_SG_BSS;
+	xonseg = 1;
+
+	/*
+	 * Collect the sections, symbols, text and relocation entries.
+	 */
+	p = xobuf;
+	while(p < xobuf+xolen) {
+		typ = *p++ & 0377;
+		len = *p++ & 0377;
+		top = p + len;
+		switch(typ) {
+
+		case OBSEC:
+			while(p < top) {
+				p += 3;
+				name = p;  p += strlen(p) + 1;
+				if(xonseg > SECSIZ) {
+					fprintf(ERROR,"Too many sections\n");
+					exit(1);
+				}
+				xoseg[xonseg].x_sg_no = 255;
+				/* the type goes by the name, as in xcon */
+				if(strncmp(name,"__text",6) == 0)
+					xoseg[xonseg].x_sg_typ = X_SG_COD;
+				if(strncmp(name,"__con",5) == 0)
+					xoseg[xonseg].x_sg_typ = X_SG_CON;
+				if(strncmp(name,"__data",6) == 0)
+					xoseg[xonseg].x_sg_typ = X_SG_DAT;
+				if(strncmp(name,"__bss",5) == 0)
+					xoseg[xonseg].x_sg_typ = X_SG_BSS;
+				sp = (struct xosym *)xoadd(&xosym,&xonsym,
+					&xomsym,sizeof *xosym);
+				sp->xs_str = name;
+				sp->xs_typ = X_SY_SEG;
+				sp->xs_val = 0;
+				sp->xs_sec = xonseg++;
+			}
+			break;
+
+		case OBGLO:
+		case OBLOC:
+			while(p < top) {
+				sp = (struct xosym *)xoadd(&xosym,&xonsym,
+					&xomsym,sizeof *xosym);
+				sp->xs_val = (p[0]&0377) | (p[1]&0377)<<8;
+				sp->xs_sec = p[4] & 0377;
+				p += 5;
+				sp->xs_str = p;  p += strlen(p) + 1;
+				sp->xs_typ = typ==OBGLO ? X_SY_GLB : X_SY_LOC;
+				if(sp->xs_sec == RBUND) {
+					if(xonext >= EXTMAX) {
+						fprintf(ERROR,"Too many externals\n");
+						exit(1);
+					}
+					xoext[xonext++] = xonsym - 1;
+					sp->xs_typ = X_SY_UNX;
+				}
+			}
+			break;
+
+		case OBTXT:
+			loc = (p[0]&0377) | (p[1]&0377)<<8;
+			sec = p[4] & 0377;
+			len = p[5] & 0377;
+			p += 6;
+			if(loc+len > xoseg[sec].x_sg_len)
+				xoseg[sec].x_sg_len = loc+len;
+			tp = (struct xotxt *)xoadd(&xotxt,&xontxt,
+				&xomtxt,sizeof *xotxt);
+			tp->xt_ptr = p;
+			tp->xt_loc = loc;
+			tp->xt_sec = sec;
+			tp->xt_len = len;
+			p += len;
+			while(p < top) {
+				rp = (struct xorel *)xoadd(&xorel,&xonrel,
+					&xomrel,sizeof *xorel);
+				rp->xr_loc = loc + (p[0]&0377) - 6;
+				ent = (p[1]&0377) | (p[2]&0377)<<8;
+				p += 3;
+				act = ent & RAMSK;
+				bas = ent & RBMSK;
+				switch(act) {
+
+				case RAA32M:
+					rp->xr_loc += 2;
+					/* fall through */
+
+				case RAA16M:
+				case RAZOF:
+					rp->xr_typ = bas<RBEXT ? X_RL_OFF : X_RL_XOF;
+					break;
+
+				case RAZSS:
+					rp->xr_typ = bas<RBEXT ? X_RL_SSG : X_RL_XSSG;
+					break;
+
+				case RAZLS:
+					rp->xr_typ = bas<RBEXT ? X_RL_LSG : X_RL_XLSG;
+					break;
+
+				case RAZNOT:
+					rp->xr_typ = X_RL_NOTE;
+					break;
+
+				default:
+					fprintf(ERROR,"Illegal reloc. 0x%x\n",ent);
+					exit(1);
+				}
+				if(act==RAZLS || act==RAZSS || act==RAZOF)
+					magic = X_SU_MAGIC;
+				rp->xr_sec = sec;
+				rp->xr_bas = bas;
+			}
+			break;
+		}
+		p = top;
+	}
+
+	/*
+	 * Lay the file out: segment 0 never has anything in it.
+	 */
+	if(xonext == 0)
+		magic = magic==X_SU_MAGIC ? X_SX_MAGIC : X_NXN_MAGIC;
+	off = sizeof(struct x_hdr) + (xonseg-1) * sizeof(struct x_sg);
+	init = 0;
+	for(i=0 ; i<xonseg ; i++) {
+		segoff[i] = off;
+		if(xoseg[i].x_sg_typ!=X_SG_BSS && xoseg[i].x_sg_typ!=X_SG_STK) {
+			off += xoseg[i].x_sg_len;
+			init += xoseg[i].x_sg_len;
+		}
+	}
+	reloff = off;
+	size = off + (long)xonrel*sizeof(struct x_rel)
+		+ (long)xonsym*sizeof(struct x_sym);
+	if((xoimg = calloc(size,1)) == NULL) {
+		fprintf(ERROR,"Out of memory for x.out\n");
+		exit(1);
+	}
+
+	xopt = xoimg;
+	xow(magic);
+	xow(xonseg-1);
+	xow((uns)(init>>16));  xow((uns)init);
+	off = (long)xonrel*sizeof(struct x_rel);
+	xow((uns)(off>>16));  xow((uns)off);
+	off = (long)xonsym*sizeof(struct x_sym);
+	xow((uns)(off>>16));  xow((uns)off);
+	for(i=1 ; i<xonseg ; i++) {
+		xob(xoseg[i].x_sg_no);
+		xob(xoseg[i].x_sg_typ);
+		xow(xoseg[i].x_sg_len);
+	}
+	for(tp=xotxt ; tp<&xotxt[xontxt] ; tp++) {
+		if(tp->xt_sec >= xonseg) continue;
+		off = segoff[tp->xt_sec] + tp->xt_loc;
+		len = tp->xt_len;
+		if(off+len > reloff) len = off<reloff ? reloff-off : 0;
+		memcpy(xoimg+off,tp->xt_ptr,len);
+	}
+	xopt = xoimg + reloff;
+	for(rp=xorel ; rp<&xorel[xonrel] ; rp++) {
+		bas = rp->xr_bas;
+		if(rp->xr_typ == X_RL_NOTE)
+			;		/* bas is an X_NT_ code */
+		else if(bas >= RBEXT)
+			bas = xoext[bas-RBEXT];
+		else
+			bas--;
+		xob(rp->xr_sec-1);
+		xob(rp->xr_typ);
+		xow(rp->xr_loc);
+		xow(bas);
+	}
+	for(sp=xosym ; sp<&xosym[xonsym] ; sp++) {
+		xob(sp->xs_sec==RBABS || sp->xs_sec==RBUND ? 255 : sp->xs_sec-1);
+		xob(sp->xs_typ);
+		xow(sp->xs_val);
+		name = sp->xs_str;
+		for(i=0 ; i<XNAMELN ; i++) {
+			xob(*name);
+			if(*name) name++;
+		}
+	}
+
+	name = oflag ? optfile : "x.out";
+	if((fd = open(name,O_WRONLY|O_CREAT|O_TRUNC,xonext?0666:0777)) == -1) {
+		fprintf(ERROR,"Cannot create %s\n",name);
+		exit(1);
+	}
+	if(write(fd,xoimg,size) != size) {
+		fprintf(ERROR,"Cannot write %s\n",name);
+		exit(1);
+	}
+	close(fd);
+}
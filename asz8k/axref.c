@@ -114,7 +114,7 @@ sysort() {
 
 uns	halfi, i, j;
 
-	for(i=1<<SHSHLOG ; i>1 ; i=halfi) {
+	for(i=syhsiz ; i>1 ; i=halfi) {
 		halfi = i>>1;
 		for(j=0 ; j<halfi ; j++) {
 			syhtab[j] = symerge(syhtab[j],syhtab[j+halfi]);
@@ -38,6 +38,7 @@
 #define RAJ11	0x5000		/* 8051 11-bit jump target relocation */
 #define RASOFF	0xd000		/* 8086 short offset relocation */
 #define	RAZOF	0x3000		/* relocate Z8001 16-bit offset */
+#define	RAZNOT	0x7000		/* Z8000 note on the instruction here */
 #define	RAMSK	0xf000		/* mask for relocation action field */
 /*
  * Object file relocation bases.
@@ -47,6 +48,14 @@
 #define	RBUND	255		/* undefined */
 #define	RBEXT	256		/* external */
 #define	RBMSK	0x0fff		/* mask for relocation base field */
+/*
+ * Bases for RAZNOT, saying what the instruction is.
+ */
+#define	RNJMP	1		/* jp cc,address or call address */
+#define	RNR7	2		/* 7-bit relative address (djnz) */
+#define	RNR8	3		/* 8-bit relative address (jr) */
+#define	RNR12	4		/* 12-bit relative address (calr) */
+#define	RNR16	5		/* 16-bit relative address (ldr, ldar) */
 /*
  * Section attributes.
  */
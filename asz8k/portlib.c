@@ -3,6 +3,7 @@
  */
 #include <stdio.h>
 #include <fcntl.h>
+#include <sys/time.h>
 
 /*
  * opena - Open a file for reading (text/ascii mode on CP/M).
@@ -61,3 +62,16 @@ char **argv;
 {
 	exit(0);
 }
+
+/*
+ * wtime - Wall clock time in microseconds, for the -S timings.
+ * CP/M has no clock; there this can just return 0.
+ */
+long
+wtime()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000000L + tv.tv_usec;
+}
@@ -153,6 +153,7 @@ extern short oflag; /* bool: debug operators */
 extern short gflag; /* bool: generate line labels for cdb */
 extern short lflag; /* bool: assume long address variables */
 extern short aesflag; /* bool: unused on Z8002 */
+extern short fsflag; /* bool: a section for each function and data object */
 
 /* expression tree storage */
 #define EXPSIZE     4096
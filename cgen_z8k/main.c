@@ -54,6 +54,7 @@ short gflag; /* bool: generate line labels for cdb */
 short m68010; /* bool: generate code for m68010 */
 short lflag = 1; /* bool: assume long address variables */
 short aesflag; /* bool: hack for TOS 1.x AES */
+short fsflag; /* bool: a section for each function and data object */
 
 
 short nextlabel = 10000;
@@ -68,6 +69,20 @@ static FILE *ifil, *lfil, *ofil;
 
 static char const program_name[] = "c1z8k";
 
+/*
+ * Sections for -F.  Each function and each data object starts a section
+ * of its own, __textNN or __dataNN (NN in base 36), so that ld8k -g can
+ * leave out the ones nothing refers to.  A .text or .data is held back
+ * until the next line shows whether an object starts there: a C name
+ * (_xxx:) in code, or any label in data.  Anything else, such as code
+ * after a switch table, goes back to the section it came from.
+ */
+#define FSMAX 200	/* asz8k takes at most 255 sections */
+
+static short fspend;	/* 't' or 'd': a held-back .text or .data */
+static short fsnum;	/* sections started so far */
+static short fscur[2];	/* current text and data section, 0 for the default */
+
 
 
 
@@ -331,6 +346,26 @@ PP(int maxregs;)
 	return count;
 }
 
+/*
+ * fsect - Put out the section switch held back by -F, before line p.
+ */
+static VOID fsect(P(const char *) p)
+PP(const char *p;)
+{
+	static char const digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+	short *cur;
+
+	cur = &fscur[fspend == 'd'];
+	if (strchr(p, ':') != NULL && (*p == '_' || (fspend == 'd' && *p == 'L')) &&
+	    fsnum < FSMAX)
+		*cur = ++fsnum;
+	oprintf(fspend == 'd' ? "__data" : "__text");
+	if (*cur)
+		oprintf("%c%c", digits[*cur / 36], digits[*cur % 36]);
+	oprintf("\t.sect\n");
+	fspend = 0;
+}
+
 /*
  * translate_68k_line - translate 68000 prologue/epilogue instructions to Z8002
  *
@@ -347,6 +382,15 @@ PP(const char *line;)
 	p = line;
 	while (*p == ' ' || *p == '\t') p++;
 
+	if (fsflag) {
+		if (strcmp(p, ".text") == 0 || strcmp(p, ".data") == 0) {
+			fspend = p[1];
+			return;
+		}
+		if (fspend)
+			fsect(p);
+	}
+
 	/* handle label prefix(es) (e.g., "L2:L1:unlk R14") */
 	for (;;) {
 		const char *colon = strchr(p, ':');
@@ -834,11 +878,12 @@ _va_dcl
 /* usage - output usage message */
 static VOID usage(NOTHING)
 {
-	error(_("usage: %s icode link asm [-DTacemov]"), program_name);
+	error(_("usage: %s icode link asm [-DFTacemov]"), program_name);
 	error(_("options:"));
 	error(_("    -L    assume long (32bit) address variables (default)"));
 	error(_("    -a    assume short (16bit) address variables"));
 	error(_("    -g    generate line labels for cdb"));
+	error(_("    -F    put each function and data object in a section of its own"));
 	error(_("    -d    include line numbers in assembly output"));
 	error(_("    -t    generate code for 68010"));
 #ifdef DEBUG
@@ -898,6 +943,10 @@ PP(char **argv;)
 				gflag++;
 				continue;
 
+			case 'F':					/* a section per function and data object */
+				fsflag++;
+				continue;
+
 			case 'D':
 			case 'd':
 				dflag++;
@@ -42,76 +42,75 @@ char const ctype[] = {
 struct stackstruc *filep;
 struct stackstruc filestack[FSTACK];
 int lineno;
-char pbbuf[PBSIZE];					/* push back buffer */
-char *pbp;							/* push back pointer */
+struct pbframe *pbstack;			/* push back stack */
+int pbdepth;						/* frames on it */
+static int pbmax;					/* frames it has room for */
 int pbflag;							/* checks for recursive definition */
-struct symbol symtab[HSIZE];
+static struct symbol **symtab;		/* hash chains of symbols */
+static unsigned int symsize;		/* number of chains, a power of 2 */
+static unsigned int symcount;		/* number of symbols */
 
 
 /*
- * symhash - compute hash value for symbol
- *      Sums the symbols characters and takes that modulus the hash table
- *      size.
- * returns hash value for symbol
+ * strhash - compute hash value for a string (FNV-1a)
  */
-static int symhash(P(const char *) sym)
-PP(const char *sym;)
+unsigned int strhash(P(const char *) s)
+PP(const char *s;)
 {
-	register const char *p;
-	register int hashval, i;
+	register unsigned long h;
 
-	for (p = sym, i = SSIZE, hashval = 0; *p != '\0' && i > 0; i--)
-		hashval += *p++;
-	return hashval % (HSIZE - 2);
+	for (h = 2166136261UL; *s != '\0'; s++)
+		h = ((h ^ (*s & 0xff)) * 16777619UL) & 0xffffffffUL;
+	return (unsigned int) h;
 }
 
 
 /*
- * symequal - check for symbol equality
- *      Does comparison between two symbols.
- * returns 1 if equal, 0 otherwise
+ * symgrow - double the number of hash chains
+ *      Relinks the symbols into the new chains by their saved hash.
  */
-static int symequal(P(const char *) sym1, P(const char *) sym2)
-PP(const char *sym1;)
-PP(const char *sym2;)
+static VOID symgrow(NOTHING)
 {
-	register const char *p;
-	register const char *q;
-	register int i;
+	register struct symbol **tab;
+	register struct symbol *sp;
+	register struct symbol *next;
+	register unsigned int i, n;
 
-	q = sym2;
-	i = SSIZE;
-	for (p = sym1; *p == *q++;)
+	n = symsize ? symsize * 2 : HSIZE;
+	if ((tab = lmalloc((long)n * sizeof(*tab))) == NULL)
+	{
+		error(_("symbol table overflow"));
+		cexit();
+	}
+	for (i = 0; i < n; i++)
+		tab[i] = NULL;
+	for (i = 0; i < symsize; i++)
 	{
-		if (*p++ == '\0' || --i == 0)
+		for (sp = symtab[i]; sp != NULL; sp = next)
 		{
-			return TRUE;
+			next = sp->s_next;
+			sp->s_next = tab[sp->s_hash & (n - 1)];
+			tab[sp->s_hash & (n - 1)] = sp;
 		}
 	}
-	return FALSE;
+	if (symtab)
+		free(symtab);
+	symtab = tab;
+	symsize = n;
 }
 
 
 /*
- * symcopy - symbol copy
- *      Copies one symbol to another.
+ * symclear - mark every symbol as never defined
  */
-VOID symcopy(P(const char *) sym1, P(char *) sym2)
-PP(const char *sym1;)
-PP(char *sym2;)
+VOID symclear(NOTHING)
 {
-	register const char *p;
-	register char *q;
-	register int i;
+	register struct symbol *sp;
+	register unsigned int i;
 
-	for (p = sym1, q = sym2, i = SSIZE; --i >= 0;)
-	{
-		if (*p)
-			*q++ = *p++;
-		else
-			*q++ = '\0';
-	}
-	*q = '\0';
+	for (i = 0; i < symsize; i++)
+		for (sp = symtab[i]; sp != NULL; sp = sp->s_next)
+			sp->s_def = -1;
 }
 
 
@@ -169,24 +168,114 @@ _va_dcl
 }
 
 
+/*
+ * pbroom - make room for n characters in a frame
+ */
+VOID pbroom(P(struct pbframe *) fp, P(int) n)
+PP(struct pbframe *fp;)
+PP(int n;)
+{
+	if (n <= fp->f_size)
+		return;
+	if (n < fp->f_size * 2)
+		n = fp->f_size * 2;
+	fp->f_size = n;
+	if ((fp->f_buf = lrealloc(fp->f_buf, (long)n)) == NULL ||
+		(fp->f_tlen = lrealloc(fp->f_tlen, (long)n * sizeof(short))) == NULL)
+	{
+		error(_("too many characters pushed back"));
+		cexit();
+	}
+}
+
+
+/*
+ * pbframe - push a frame with room for n characters on the push back stack
+ *      The caller fills in f_buf, and f_tlen with the length of each
+ *      token tokfast allows where it starts, and elsewhere 0, and sets
+ *      f_len.
+ */
+struct pbframe *pbframe(P(int) n)
+PP(int n;)
+{
+	register struct pbframe *fp;
+
+	if (pbdepth >= pbmax)
+	{
+		pbmax = pbmax ? pbmax * 2 : 16;
+		if ((pbstack = lrealloc(pbstack, (long)pbmax * sizeof(*pbstack))) == NULL)
+		{
+			error(_("too many characters pushed back"));
+			cexit();
+		}
+		memset(&pbstack[pbdepth], 0, (pbmax - pbdepth) * sizeof(*pbstack));
+	}
+	fp = &pbstack[pbdepth++];
+	pbroom(fp, n);
+	fp->f_pos = 0;
+	return fp;
+}
+
+
+/*
+ * tokfast - can gettok take this token whole, in a macro expansion
+ *      Only if it would read it the same a character at a time: single
+ *      characters that never start a longer token, and names and numbers
+ *      when next, the character after them, does not run on.  next is
+ *      -1 when it is not known.
+ */
+int tokfast(P(const char *) s, P(int) next)
+PP(const char *s;)
+PP(int next;)
+{
+	register const char *p;
+	register int t;
+
+	switch (ctype[*s & 0xff])
+	{
+	case CEOF:
+	case SQUOTE:
+	case DQUOTE:
+	case NOT:
+	case GREAT:
+	case LESS:
+	case EQUAL:
+	case DIV:
+	case BADC:
+		return FALSE;
+
+	case DIGIT:
+	case ALPHA:
+		if (next < 0 || (t = ctype[next & 0xff]) == ALPHA || t == DIGIT)
+			return FALSE;
+		for (p = s; *p; p++)
+			if ((t = ctype[*p & 0xff]) != ALPHA && t != DIGIT)
+				return FALSE;
+		return p - s < TOKSIZE - 1;
+
+	default:
+		return s[1] == '\0';
+	}
+}
+
+
 /*
  * putback - puts back a single character
- *      Checks for push back buffer overflow.
+ *      It goes just before the next character of the top frame if there
+ *      is room, else into a new frame.
  */
 VOID putback(P(int) c)
 PP(int c;)
 {
-	if (pbp >= &pbbuf[PBSIZE])
+	register struct pbframe *fp;
+
+	if (pbdepth == 0 || (fp = &pbstack[pbdepth - 1])->f_pos == 0)
 	{
-		int l = (intptr_t)pbp - (intptr_t)pbbuf;
-		
-		error(_("too many characters pushed back %d"), l);
-		while (pbp > pbbuf)
-			fputc(*--pbp, stderr);
-		fputc('\n', stderr);
-		cexit();
+		fp = pbframe(PBSIZE);
+		fp->f_pos = fp->f_len = PBSIZE;
 	}
-	*pbp++ = c;
+	fp->f_buf[--fp->f_pos] = c;
+	fp->f_tlen[fp->f_pos] = 0;
 }
 
 
@@ -204,46 +293,35 @@ PP(const char *s;)
 }
 
 
-static int rgetch(P(FILE *) fp)
-PP(FILE *fp;)
-{
-	int c;
-	
-	c = getc(fp);
-	if (c == 0x0d)
-	{
-		c = getc(fp);
-		if (c != 0x0a)
-		{
-			if (c != EOF)
-				putback(c);
-		}
-		c = '\n';
-	}
-	return c;
-}
-
-
 /*
  * ngetch - get a (possibly) pushed back character
- *      This handles the include file stack and incrementing the line
+ *      Otherwise takes the next character of the file in memory.  This
+ *      handles the include file stack and incrementing the line
  *      number for the lowest level file.
  * returns character or CEOF
  */
 int ngetch(NOTHING)
 {
+	register struct pbframe *fp;
 	register int c;
 
-	if (pbp > &pbbuf[0])
-		return *--pbp;
+	if (pbdepth > 0)
+	{
+		fp = &pbstack[pbdepth - 1];
+		c = fp->f_buf[fp->f_pos++] & 0xff;
+		if (fp->f_pos >= fp->f_len)
+			pbdepth--;
+		return c;
+	}
 	pbflag = 0;
-	while ((c = rgetch(inbuf)) < 0)
+	while (inbuf.i_ptr >= inbuf.i_end)
 	{
 		if (filep == &filestack[0])
 			return CEOF;
-		fclose(inbuf);
+		inclend(filep - 1);
+		free(inbuf.i_buf);
 		filep--;
-		inbuf = filep->ifd;
+		inbuf = filep->ibuf;
 		if (filep == &filestack[0])
 		{								/* need line for #include... */
 			lineno++;
@@ -254,43 +332,58 @@ int ngetch(NOTHING)
 			putid((filep - 1)->ifile, (filep - 1)->lineno);
 		}
 	}
-	return c;
+	return *inbuf.i_ptr++ & 0xff;
+}
+
+
+/*
+ * findsp - find symbol pointer
+ *      Searches the symbol's hash chain for it.
+ * returns the symbol table entry, or NULL if there is none
+ */
+static struct symbol *findsp(P(const char *) name, P(unsigned int) hash)
+PP(const char *name;)
+PP(unsigned int hash;)
+{
+	register struct symbol *sp;
+
+	if (symsize == 0)
+		return NULL;
+	for (sp = symtab[hash & (symsize - 1)]; sp != NULL; sp = sp->s_next)
+		if (sp->s_hash == hash && strcmp(sp->s_name, name) == 0)
+			return sp;
+	return NULL;
 }
 
 
 /*
  * getsp - get symbol pointer
- *      Calculates the symbol table pointer for a given symbol, if symbol
- *      is not defined, will point to appropriate place to insert symbol.
+ *      Finds the symbol table entry for a given symbol, if there is none
+ *      one is added, not yet defined.
  */
 struct symbol *getsp(P(const char *) name)
 PP(const char *name;)
 {
-	register int wrap;
 	register struct symbol *sp;
-	register struct symbol *asp;
-	register long i;
-	
-	wrap = 0;
-	asp = 0;
-	i = symhash(name);
-	for (sp = &symtab[i]; sp->s_def >= 0;)
+	register unsigned int hash;
+
+	hash = strhash(name);
+	if ((sp = findsp(name, hash)) != NULL)
+		return sp;
+	if (symcount >= symsize)
+		symgrow();
+	if ((sp = lmalloc((long)sizeof(*sp) + strlen(name))) == NULL)
 	{
-		if (symequal(sp->s_name, name))
-			return sp;
-		if (!asp && sp->s_def < 0)
-			asp = sp;
-		if (++sp >= &symtab[(long)HSIZE])
-		{
-			if (wrap++)
-			{
-				error(_("symbol table overflow"));
-				cexit();
-			}
-			sp = &symtab[0];
-		}
+		error(_("symbol table overflow"));
+		cexit();
 	}
-	return asp ? asp : sp;
+	strcpy(sp->s_name, name);
+	sp->s_hash = hash;
+	sp->s_def = -1;
+	sp->s_next = symtab[hash & (symsize - 1)];
+	symtab[hash & (symsize - 1)] = sp;
+	symcount++;
+	return sp;
 }
 
 
@@ -303,8 +396,8 @@ PP(const char *name;)
 {
 	register struct symbol *sp;
 
-	sp = getsp(name);
-	if (sp->s_def <= 0)
+	sp = findsp(name, strhash(name));
+	if (sp == NULL || sp->s_def <= 0)
 		return NULL;
 	return sp;
 }
@@ -342,7 +435,23 @@ PP(char *token;)
 	register int type;
 	register int t;
 	register int l;
+	register struct pbframe *fp;
 
+	if (pbdepth > 0)
+	{
+		fp = &pbstack[pbdepth - 1];
+		if ((l = fp->f_tlen[fp->f_pos]) != 0)
+		{								/* a whole token from a macro expansion */
+			s = &fp->f_buf[fp->f_pos];
+			type = ctype[*s & 0xff];
+			for (p = token; --l >= 0;)
+				*p++ = *s++;
+			*p = '\0';
+			if ((fp->f_pos = s - fp->f_buf) >= fp->f_len)
+				pbdepth--;
+			return type;
+		}
+	}
 	p = token;
 	c = ngetch();
 	*p++ = c;
@@ -360,6 +469,21 @@ PP(char *token;)
 
 	case DIGIT:
 	case ALPHA:
+		if (pbdepth == 0)
+		{								/* take what we can straight from the file */
+			for (s = inbuf.i_ptr; s < inbuf.i_end && p < &token[TOKSIZE]; *p++ = *s++)
+				if ((t = ctype[*s & 0xff]) != ALPHA && t != DIGIT)
+					break;
+			inbuf.i_ptr = s;
+		} else
+		{								/* or from the frame on top */
+			fp = &pbstack[pbdepth - 1];
+			for (s = &fp->f_buf[fp->f_pos]; s < &fp->f_buf[fp->f_len] && p < &token[TOKSIZE]; *p++ = *s++)
+				if ((t = ctype[*s & 0xff]) != ALPHA && t != DIGIT)
+					break;
+			if ((fp->f_pos = s - fp->f_buf) >= fp->f_len)
+				pbdepth--;
+		}
 		for (; p < &token[TOKSIZE]; p++)
 		{
 			c = ngetch();
@@ -422,7 +546,7 @@ PP(char *token;)
 			{
 				if (c == '\n')
 				{
-					if (filep == &filestack[0] && pbp == &pbbuf[0])
+					if (filep == &filestack[0] && pbdepth == 0)
 						lineno++;
 					if (Cflag)
 					{
@@ -10,8 +10,7 @@
 #include <unistd.h>
 
 #ifndef __ALCYON__
-#  define lmalloc(size) malloc(size)
-#  define lrealloc(ptr, size) realloc(ptr, size)
+#  include <dirent.h>
 #endif
 
 int literal;
@@ -20,9 +19,9 @@ char lit_file[MAXPSIZE];
 int nincl;
 char *incl[NINCL];
 
-char line[LINESIZE+2];				/* line buffer */
+char *line;							/* line buffer */
 char *linep;						/* current line pointer */
-int loverflow;						/* line overflow flag */
+static char *lineend;				/* end of the line buffer */
 
 struct defstruc defs[NDEFS];
 
@@ -32,6 +31,10 @@ static int defcount;				/* bytes left in define area */
 static long defused;				/* number of bytes used in define area */
 static long defmax;					/* maximum define area used */
 
+static char *abuf;					/* macro arguments, as tokens ended by '\0' */
+static long abused;					/* bytes used in abuf */
+static long absize;					/* room in abuf */
+
 static int clabel = LABSTART;
 static int nlabel = LABSTART + 1;
 
@@ -51,6 +54,7 @@ static struct builtin
 	{ "endif", ENDIF },
 	{ "if", IF },
 	{ "line", LINE },
+	{ "pragma", PRAGMA },
 	{ 0, 0 }
 };
 
@@ -58,6 +62,38 @@ static char cstack[CSTKSIZE];
 static char *cstkptr;
 static char inclname[TOKSIZE];
 
+/*
+ * include files that need not be read again: those with #pragma once,
+ * and those wholly inside #ifndef o_guard, while o_guard is defined
+ */
+static struct onceinc
+{
+	struct onceinc *o_next;
+	char *o_file;
+	char *o_guard;					/* NULL for #pragma once */
+} *oncelist;
+
+/* where each #include has been found, or not, before */
+#define	IHSIZE	256
+static struct inclcache
+{
+	struct inclcache *i_next;
+	char *i_dir;					/* includer's directory for "", else NULL */
+	char *i_name;
+	char *i_path;					/* the file, or the last place tried */
+} *incltab[IHSIZE];
+
+#ifndef __ALCYON__
+/* directories read for inclfound, with their entries sorted */
+static struct dircache
+{
+	struct dircache *d_next;
+	char *d_name;
+	char **d_ent;
+	int d_nent;
+} *dirlist;
+#endif
+
 
 /*
  * putd - put a character to the define buffer
@@ -83,6 +119,77 @@ PP(int c;)
 }
 
 
+/*
+ * A macro body is kept in the define area as a list of tokens, each
+ * a kind byte, what goes with it and a '\0', ended by a '\0' kind.
+ * The actual arguments are kept in abuf as TTEXT and TFAST tokens.
+ */
+#define	TTEXT		1				/* text to put back as it is */
+#define	TFAST		2				/* text that tokfast allows */
+#define	TARG		3				/* a formal argument, its number follows */
+#define	TSUBST		4				/* a string, with ARG n for each formal argument */
+
+static long dlast = -1;				/* last TTEXT put in the define area, or -1 */
+
+
+/*
+ * tokend - say what follows the last TTEXT put in the define area
+ *      c is its first character, or -1 if that is not known.
+ */
+static VOID tokend(P(int) c)
+PP(int c;)
+{
+	if (dlast >= 0 && tokfast(defap + dlast + 1, c))
+		defap[dlast] = TFAST;
+	dlast = -1;
+}
+
+
+/*
+ * puttok - put a token of text to the define buffer
+ */
+static VOID puttok(P(const char *) s)
+PP(const char *s;)
+{
+	if (*s == '\0')
+		return;
+	tokend(*s & 0xff);
+	dlast = defused;
+	putd(TTEXT);
+	while (*s)
+		putd(*s++);
+	putd('\0');
+}
+
+
+/*
+ * putab - put a token of text to the argument buffer
+ *      The buffer grows as needed.
+ */
+static VOID putab(P(const char *) s)
+PP(const char *s;)
+{
+	register char *p;
+	register long l;
+
+	l = strlen(s) + 2;
+	if (abused + l > absize)
+	{
+		absize = abused + l + ARGBSIZE;
+		if ((abuf = lrealloc(abuf, absize)) == NULL)
+		{
+			error(_("argument buffer overflow"));
+			cexit();
+		}
+	}
+	p = abuf + abused;
+	abused += l;
+	*p++ = TTEXT;
+	while ((*p++ = *s++) != '\0')
+		;
+}
+
+
 static VOID dinstall(P(const char *) name, P(const char *) def)
 PP(const char *name;)								/* macro name */
 PP(const char *def;)								/* pointer to definition */
@@ -90,17 +197,13 @@ PP(const char *def;)								/* pointer to definition */
 	register struct symbol *sp;
 
 	sp = getsp(name);
-	symcopy(name, sp->s_name);
 	sp->s_def = defused;
 	putd(NOARGS);
 	if (def)
-	{
-		while (*def)
-			putd(*def++);
-	} else
-	{
-		putd('1');						/* default define value */
-	}
+		puttok(def);
+	else
+		puttok("1");					/* default define value */
+	tokend(-1);
 	putd('\0');
 }
 
@@ -112,7 +215,6 @@ PP(int def;)
 	register struct symbol *sp;
 
 	sp = getsp(name);
-	symcopy(name, sp->s_name);
 	sp->s_def = defused;
 	putd(def);
 	putd('\0');
@@ -176,8 +278,7 @@ PP(const char *name;)
 {
 	register struct symbol *sp;
 
-	sp = getsp(name);
-	if (sp->s_def > 0)
+	if ((sp = lookup(name)) != NULL)
 		sp->s_def = 0;
 }
 
@@ -209,7 +310,24 @@ PP(const char *token;)
 }
 
 
-/* trymatch - check for arguments */
+/*
+ * putsd - put a character of a string to the define buffer
+ *      ARG is doubled, so that it is not taken for an argument.
+ */
+static VOID putsd(P(int) c)
+PP(int c;)
+{
+	if (c == ARG)
+		putd(ARG);
+	putd(c);
+}
+
+
+/*
+ * trymatch - check for arguments
+ *      A name is either a formal argument or not, but formal arguments
+ *      are substituted anywhere inside a string.
+ */
 static VOID trymatch(P(const char *) token, P(int) type, P(int) nargs, P(char **) args)
 PP(const char *token;)
 PP(int type;)
@@ -219,9 +337,26 @@ PP(char **args;)
 	register const char *p;
 	register int i, len;
 
+	if (type == ALPHA)
+	{
+		for (i = 0; i < nargs; i++)
+		{
+			if (strcmp(args[i], token) == 0)
+			{							/* formal arg */
+				tokend(-1);
+				putd(TARG);
+				putd(i + 1);
+				putd('\0');
+				return;
+			}
+		}
+		puttok(token);
+		return;
+	}
 	p = token;
-	if (type != ALPHA)
-		putd(*p++);
+	tokend(*p & 0xff);
+	putd(TSUBST);
+	putsd(*p++);
 	while (*p != 0)
 	{
 		for (i = 0; i < nargs; i++)
@@ -231,19 +366,20 @@ PP(char **args;)
 		}
 		if (i < nargs)
 		{								/* sub ARG marker for formal arg */
-			putd(i + 1);
 			putd(ARG);
+			putd(i + 1);
 			p += len;
 		} else
 		{
 			do
 			{
-				putd(*p++);
+				putsd(*p++);
 			} while (isalnum(*p) || *p == '_');
 		}
 		while (!isalnum(*p) && *p != '_' && *p)	/* get to next possible */
-			putd(*p++);
+			putsd(*p++);
 	}
+	putd('\0');
 }
 
 
@@ -274,8 +410,7 @@ static VOID dodefine(NOTHING)
 {
 	char token[TOKSIZE];
 	char *args[MAXARGS];
-	char argbuf[ARGBSIZE];
-	register char *abp, *p;
+	long aoff[MAXARGS];
 	register int type, nargs, i;
 	register struct symbol *sp;
 
@@ -286,12 +421,11 @@ static VOID dodefine(NOTHING)
 	}
 	sp = lookup(token);
 	if (sp)
-		warning(_("redefining %.*s"), SSIZE, sp->s_name);
+		warning(_("redefining %s"), sp->s_name);
 	sp = getsp(token);
-	symcopy(token, sp->s_name);
 	sp->s_def = defused;
 	nargs = 0;
-	abp = argbuf;
+	abused = 0;
 	if ((type = gettok(token)) == LPAREN)
 	{
 		for (; (type = getfarg(token)) != RPAREN; nargs++)
@@ -301,16 +435,11 @@ static VOID dodefine(NOTHING)
 				error(_("too many arguments"));
 				break;
 			}
-			args[nargs] = abp;
-			for (p = token; (*abp++ = *p++) != 0;)
-			{
-				if (abp >= &argbuf[ARGBSIZE])
-				{
-					error(_("argument buffer overflow"));
-					break;
-				}
-			}
+			aoff[nargs] = abused;
+			putab(token);
 		}
+		for (i = 0; i < nargs; i++)
+			args[i] = abuf + aoff[i] + 1;
 		putd(nargs);
 	} else
 	{
@@ -328,19 +457,19 @@ static VOID dodefine(NOTHING)
 		{
 			if ((i = ngetch()) == '\n')
 			{							/* multi-line macro? */
-				if (filep == &filestack[0] && pbp == &pbbuf[0])
+				if (filep == &filestack[0] && pbdepth == 0)
 				{
 					lineno++;
 					fputc('\n', outbuf);
 				}
 			}
-			putd(i);
-			continue;
+			token[0] = i;
+			token[1] = '\0';
 		}
-		for (p = token; *p;)
-			putd(*p++);
+		puttok(token);
 	}
 	pbtok(token);
+	tokend(-1);
 	putd('\0');
 }
 
@@ -416,7 +545,253 @@ PP(const char *p;)
 }
 
 
-/* getinclude - get include file full pathname */
+/*
+ * readin - read a whole input file into memory
+ *      Line ends are made '\n' on the way: "\r\n" and a lone '\r' both
+ *      become '\n'.
+ * returns FALSE if the file cannot be opened
+ */
+static int readin(P(const char *) name, P(struct infile *) ip)
+PP(const char *name;)
+PP(struct infile *ip;)
+{
+	register char *p, *q, *end;
+	register FILE *fd;
+	char *buf;
+	long len, max;
+	size_t n;
+
+	if ((fd = fopen(name, "rb")) == NULL)
+		return FALSE;
+	buf = NULL;
+	len = max = 0;
+	do
+	{
+		if (len >= max)
+		{
+			max = max ? 2 * max : 8192;
+			if ((buf = lrealloc(buf, max)) == NULL)
+			{
+				error(_("out of memory reading %s"), name);
+				cexit();
+			}
+		}
+		n = fread(buf + len, 1, max - len, fd);
+		len += n;
+	} while (n > 0);
+	fclose(fd);
+	end = buf + len;
+	for (p = q = buf; p < end; p++)
+	{
+		if (*p == 0x0d)
+		{
+			*q++ = '\n';
+			if (p + 1 < end && p[1] == 0x0a)
+				p++;
+		} else
+		{
+			*q++ = *p;
+		}
+	}
+	ip->i_buf = ip->i_ptr = buf;
+	ip->i_end = q;
+	return TRUE;
+}
+
+
+/*
+ * savestr - make a copy of a string
+ */
+static char *savestr(P(const char *) s)
+PP(const char *s;)
+{
+	register char *p;
+
+	if ((p = lmalloc((long)strlen(s) + 1)) == NULL)
+	{
+		error(_("out of memory"));
+		cexit();
+	}
+	return strcpy(p, s);
+}
+
+
+/*
+ * inclend - note at the end of an include file whether it need be read
+ *      again, from what it had in it.
+ */
+VOID inclend(P(struct stackstruc *) fp)
+PP(struct stackstruc *fp;)
+{
+	register struct onceinc *op;
+
+	if (fp->once || fp->gstate == GOUT)
+	{
+		if ((op = lmalloc((long)sizeof(*op))) == NULL)
+		{
+			error(_("out of memory"));
+			cexit();
+		}
+		op->o_file = savestr(fp->ifile);
+		op->o_guard = NULL;
+		if (!fp->once)
+		{
+			op->o_guard = fp->gname;
+			fp->gname = NULL;
+		}
+		op->o_next = oncelist;
+		oncelist = op;
+	}
+	free(fp->gname);
+	fp->gname = NULL;
+}
+
+
+/*
+ * inclskip - check whether an include file can be left out
+ * returns TRUE if it has #pragma once, or is wholly inside an #ifndef
+ *      of a macro that is now defined, and has been included before
+ */
+static int inclskip(P(const char *) fname)
+PP(const char *fname;)
+{
+	register struct onceinc *op;
+
+	for (op = oncelist; op != NULL; op = op->o_next)
+	{
+		if (strcmp(op->o_file, fname) == 0 &&
+			(op->o_guard == NULL || lookup(op->o_guard) != NULL))
+			return TRUE;
+	}
+	return FALSE;
+}
+
+
+/*
+ * guardif - an #ifndef at the outermost level of an include file
+ *      If it is the first thing in the file, it may be the guard.
+ */
+static VOID guardif(P(struct stackstruc *) fp, P(int) type, P(const char *) name)
+PP(struct stackstruc *fp;)
+PP(int type;)
+PP(const char *name;)
+{
+	if (fp->gstate != GNONE || type != ALPHA)
+	{
+		fp->gstate = GBAD;
+		return;
+	}
+	fp->gname = savestr(name);
+	fp->gstate = GIN;
+}
+
+
+#ifndef __ALCYON__
+static int entcmp(P(const VOIDPTR) a, P(const VOIDPTR) b)
+PP(const VOIDPTR a;)
+PP(const VOIDPTR b;)
+{
+	return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+
+/*
+ * dirfind - get a directory's entries
+ *      Reads the directory the first time it is asked for.  One that
+ *      cannot be read is taken to be empty.
+ */
+static struct dircache *dirfind(P(const char *) name)
+PP(const char *name;)
+{
+	register struct dircache *dp;
+	register struct dirent *de;
+	DIR *dirp;
+	int nmax;
+
+	for (dp = dirlist; dp != NULL; dp = dp->d_next)
+		if (strcmp(dp->d_name, name) == 0)
+			return dp;
+	if ((dp = lmalloc((long)sizeof(*dp))) == NULL)
+	{
+		error(_("out of memory"));
+		cexit();
+	}
+	dp->d_name = savestr(name);
+	dp->d_ent = NULL;
+	dp->d_nent = nmax = 0;
+	if ((dirp = opendir(name)) != NULL)
+	{
+		while ((de = readdir(dirp)) != NULL)
+		{
+			if (dp->d_nent >= nmax)
+			{
+				nmax = nmax ? 2 * nmax : 64;
+				if ((dp->d_ent = lrealloc(dp->d_ent, (long)nmax * sizeof(char *))) == NULL)
+				{
+					error(_("out of memory"));
+					cexit();
+				}
+			}
+			dp->d_ent[dp->d_nent++] = savestr(de->d_name);
+		}
+		closedir(dirp);
+		qsort(dp->d_ent, dp->d_nent, sizeof(char *), entcmp);
+	}
+	dp->d_next = dirlist;
+	dirlist = dp;
+	return dp;
+}
+#endif
+
+
+/*
+ * inclfound - check whether an include file is there
+ *      Looks in the list of its directory's entries rather than trying
+ *      to open it.
+ */
+static int inclfound(P(const char *) path)
+PP(const char *path;)
+{
+#ifdef __ALCYON__
+	register FILE *fd;
+
+	if ((fd = fopen(path, "r")) == NULL)
+		return FALSE;
+	fclose(fd);
+	return TRUE;
+#else
+	const char *base;
+	register const char *q;
+	register struct dircache *dp;
+	char dname[TOKSIZE];
+
+	for (base = q = path; *q; q++)
+		if (*q == FILESEP || *q == FILESEP2)
+			base = q + 1;
+	if (base == path)
+	{
+		strcpy(dname, ".");
+	} else if (base == path + 1)
+	{
+		dname[0] = *path;				/* the root */
+		dname[1] = '\0';
+	} else
+	{
+		strncpy(dname, path, base - path - 1);
+		dname[base - path - 1] = '\0';
+	}
+	dp = dirfind(dname);
+	return bsearch(&base, dp->d_ent, dp->d_nent, sizeof(char *), entcmp) != NULL;
+#endif
+}
+
+
+/*
+ * getinclude - get include file full pathname
+ *      Where a name has been looked for before, from the same directory
+ *      for a "" include, the answer is remembered.  If the file is not
+ *      found, the last place tried is returned.
+ */
 static char *getinclude(P(const char *) fname, P(const char *) parent)
 PP(const char *fname;)
 PP(const char *parent;)
@@ -424,26 +799,38 @@ PP(const char *parent;)
 	register const char *q;
 	register char *t;
 	register int i, ndx;
-	register FILE *fd;
+	register struct inclcache *ip, **ipp;
+	char dir[TOKSIZE];
 	
+	dir[0] = '\0';
 	if (parent)
 	{									/* include filename surrounded by quotes */
 		q = (filep == &filestack[0]) ? parent : (filep - 1)->ifile;
-		t = &inclname[0];
+		t = &dir[0];
 		while ((ndx = strindex(q, FILESEP)) >= 0)
 		{
 			ndx++;
 			while (ndx--)
 				*t++ = *q++;
 		}
+		*t = 0;
+	}
+	ipp = &incltab[strhash(fname) % IHSIZE];
+	for (ip = *ipp; ip != NULL; ip = ip->i_next)
+	{
+		if (strcmp(ip->i_name, fname) == 0 &&
+			(parent ? ip->i_dir && strcmp(ip->i_dir, dir) == 0 : !ip->i_dir))
+			return ip->i_path;
+	}
+	if (parent)
+	{
+		t = &inclname[0];
+		for (q = dir; *q; )
+			*t++ = *q++;
 		for (q = fname; (*t++ = *q++) != 0; )
 			;
-		*t = 0;
-		if ((fd = fopen(inclname, "r")) != NULL)
-		{								/* found it */
-			fclose(fd);
-			return inclname;
-		}
+		if (inclfound(inclname))		/* found it */
+			goto found;
 	}
 	for (i = 0; i < nincl; i++)
 	{
@@ -455,13 +842,21 @@ PP(const char *parent;)
 		for (q = fname; (*t++ = *q++) != 0; )
 			;
 		*t = 0;
-		if ((fd = fopen(inclname, "r")) != NULL)
-		{
-			fclose(fd);
-			return inclname;
-		}
+		if (inclfound(inclname))
+			break;
+	}
+found:
+	if ((ip = lmalloc((long)sizeof(*ip))) == NULL)
+	{
+		error(_("out of memory"));
+		cexit();
 	}
-	return inclname;
+	ip->i_dir = parent ? savestr(dir) : NULL;
+	ip->i_name = savestr(fname);
+	ip->i_path = savestr(inclname);
+	ip->i_next = *ipp;
+	*ipp = ip;
+	return ip->i_path;
 }
 
 
@@ -469,15 +864,17 @@ PP(const char *parent;)
  * doinclude - handle #include command
  *      Checks for file name or library file name and pushes file on
  *      include file stack.
+ * returns FALSE if no file was pushed: it was left out as already
+ *      included, or could not be opened
  */
-static VOID doinclude(P(const char *) infile)
+static int doinclude(P(const char *) infile)
 PP(const char *infile;)
 {
 	register int type;
 	char token[TOKSIZE];
 	char fname[TOKSIZE];
 	register char *p, *q, c;
-	FILE *ifd;
+	struct infile in;
 	
 	p = fname;
 	if ((type = getntok(token)) == SQUOTE || type == DQUOTE)
@@ -489,7 +886,7 @@ PP(const char *infile;)
 	} else if (type != LESS)
 	{
 		error(_("bad include file"));
-		return;
+		return TRUE;
 	} else
 	{
 		while ((type = gettok(token)) != GREAT && type != NEWL && type != CEOF)
@@ -501,17 +898,19 @@ PP(const char *infile;)
 		{
 			error(_("bad include file name"));
 			pbtok(token);
-			return;
+			return TRUE;
 		}
 		p = getinclude(fname, (char *) 0L);
 	}
 	eatup();							/* need here... */
+	if (inclskip(p))
+		return FALSE;
 	if (filep >= &filestack[FSTACK])
 	{
 		error(_("includes nested too deeply"));
 	} else
 	{
-		if ((ifd = fopen(p, "r")) == NULL)
+		if (!readin(p, &in))
 		{
 			if (type != SQUOTE && type != DQUOTE)
 				error(_("can't open include file %s"), p);
@@ -519,14 +918,20 @@ PP(const char *infile;)
 				error(_("can't open include file %s"), fname);
 		} else
 		{
-			filep->ifd = inbuf;
+			filep->ibuf = inbuf;
 			filep->lineno = 1;
+			filep->cbase = cstkptr;
+			filep->gstate = GNONE;
+			filep->gname = NULL;
+			filep->once = FALSE;
 			putid(p, 1);				/* id for include file */
 			doifile(p);
 			filep++;
-			inbuf = ifd;
+			inbuf = in;
+			return TRUE;
 		}
 	}
+	return FALSE;
 }
 
 
@@ -578,35 +983,28 @@ static VOID doline(NOTHING)
  * getaarg - get macro actual argument
  *      This handles the collecting of the macro's call arguments.
  *      Note that you may have parenthesis as part of the macro argument,
- *      hence you need to keep track of them.
+ *      hence you need to keep track of them.  The tokens go into abuf.
+ * returns COMMA or RPAREN, or CEOF for an empty argument
  */
-static int getaarg(P(char *) argp)
-PP(char *argp;)
+static int getaarg(NOTHING)
 {
-	int type, plevel, i;
-	register char *p;
-	register char *ap;
+	int type, plevel;
+	long last;
 	char token[TOKSIZE];
 
-	ap = argp;
-	*ap = '\0';
+	last = -1;
 	plevel = 0;
-	i = TOKSIZE;
 	while (((type = gettok(token)) != COMMA && type != RPAREN) || plevel != 0)
 	{
 		if (type == NEWL)				/* multi line macro expansion */
 		{
 			ppputl('\n');
-		} else
+		} else if (token[0] != '\0')
 		{
-			for (p = token; (*ap = *p++) != 0; ap++)
-			{
-				if (--i <= 0)
-				{
-					error(_("macro argument too long"));
-					return CEOF;
-				}
-			}
+			if (last >= 0 && tokfast(abuf + last + 1, token[0] & 0xff))
+				abuf[last] = TFAST;
+			last = abused;
+			putab(token);
 		}
 		if (type == LPAREN)
 		{
@@ -620,7 +1018,7 @@ PP(char *argp;)
 			cexit();
 		}
 	}
-	if (ap == argp)
+	if (last < 0)
 		type = CEOF;
 	return type;
 }
@@ -654,18 +1052,25 @@ static int getaline(P(const char *) infile)
 PP(const char *infile;)
 {
 	char token[TOKSIZE];
-	register int type, i;
+	register int type, i, kw, sig;
 	register struct symbol *p;
 	register const char *cp;
+	struct stackstruc *fp;
 	
 	initl();
 	if ((type = gettok(token)) == CEOF)
 		return FALSE;
+	/* fp is set while at the outermost level of an include file */
+	fp = NULL;
+	if (filep != &filestack[0] && cstkptr == (filep - 1)->cbase)
+		fp = filep - 1;
 	if (type == POUND)
 	{
 		if ((type = getntok(token)) == NEWL)
 			return TRUE;
-		switch (kwlook(token))
+		if ((kw = kwlook(token)) != IFNDEF && fp)
+			fp->gstate = GBAD;
+		switch (kw)
 		{
 		case IFDEF:
 			if (!skip && getntok(token) == ALPHA && lookup(token))
@@ -679,7 +1084,7 @@ PP(const char *infile;)
 			break;
 
 		case IFNDEF:
-			if (skip || (getntok(token) == ALPHA && lookup(token)))
+			if (skip || ((type = getntok(token)) == ALPHA && lookup(token)))
 			{
 				push(SKIP);
 				skip++;
@@ -687,6 +1092,8 @@ PP(const char *infile;)
 			{
 				push(NOSKIP);
 			}
+			if (fp)
+				guardif(fp, type, token);
 			break;
 
 		case ENDIF:
@@ -697,9 +1104,14 @@ PP(const char *infile;)
 			{
 				error(_("invalid #endif"));
 			}
+			if (filep != &filestack[0] && cstkptr == (filep - 1)->cbase &&
+				(filep - 1)->gstate == GIN)
+				(filep - 1)->gstate = GOUT;
 			break;
 
 		case ELSE:
+			if (filep != &filestack[0] && cstkptr == (filep - 1)->cbase + 1)
+				(filep - 1)->gstate = GBAD;	/* guard has an #else */
 			/* BUG: does not detect else after else */
 			if ((i = pop()) == SKIP)
 			{
@@ -731,7 +1143,11 @@ PP(const char *infile;)
 		case INCLUDE:
 			if (!skip)
 			{							/* if in skip, don't do include */
-				doinclude(infile);
+				if (!doinclude(infile))
+				{
+					ppputl('\0');		/* already included, or not there */
+					return TRUE;
+				}
 				if (filep != &filestack[0])
 					i = getaline((filep - 1)->ifile);
 				else
@@ -759,6 +1175,12 @@ PP(const char *infile;)
 			}
 			break;
 
+		case PRAGMA:
+			if (!skip && getntok(token) == ALPHA && strcmp(token, "once") == 0 &&
+				filep != &filestack[0])
+				(filep - 1)->once = TRUE;
+			break;					/* other pragmas are ignored */
+
 		default:
 			error(_("invalid preprocessor command"));
 			break;
@@ -771,8 +1193,10 @@ PP(const char *infile;)
 			eatup();
 		} else
 		{
-			for (; type != NEWL && type != CEOF; type = gettok(token))
+			for (sig = FALSE; type != NEWL && type != CEOF; type = gettok(token))
 			{
+				if (type != WHITE)
+					sig = TRUE;
 				if (type == ALPHA && (p = lookup(token)) != NULL)
 				{
 					expand(p);
@@ -782,6 +1206,8 @@ PP(const char *infile;)
 						ppputl(*cp++);
 				}
 			}
+			if (sig && fp)
+				fp->gstate = GBAD;		/* text outside any guard */
 		}
 	}
 	ppputl('\0');
@@ -798,10 +1224,9 @@ int domacro(P(int) nd)
 PP(int nd;)
 {
 	register char *l;
-	register struct symbol *sp;
 
 	filep = &filestack[0];
-	if ((inbuf = fopen(source, "r")) == NULL)
+	if (!readin(source, &inbuf))
 	{
 		error(_("can't open source file %s\n"), source);
 		return FALSE;
@@ -818,8 +1243,7 @@ PP(int nd;)
 	putid(source, 1);					/* identify as first line in source file */
 
 	/* clear out symbol table */
-	for (sp = &symtab[0]; sp <= &symtab[(long)HSIZE - 1]; sp++)
-		sp->s_def = -1;
+	symclear();
 	defap = lmalloc((long)DEFSIZE);
 	if (defap == NULL)
 	{
@@ -831,7 +1255,7 @@ PP(int nd;)
 	defused = 0;
 	putd('\0');
 
-	pbp = &pbbuf[0];
+	pbdepth = 0;
 	cstkptr = &cstack[0];
 	install("Newlabel", NEWLABEL);
 	install("Label", LABEL);
@@ -840,7 +1264,7 @@ PP(int nd;)
 	while (getaline(source))
 	{
 		l = line;
-		if (filep == &filestack[0] && pbp == &pbbuf[0])
+		if (filep == &filestack[0] && pbdepth == 0)
 			lineno++;
 		else if (filep != &filestack[0])
 			(filep - 1)->lineno++;
@@ -869,7 +1293,7 @@ PP(int nd;)
 	fflush(outbuf);
 	if (!Eflag)
 		fclose(outbuf);
-	fclose(inbuf);
+	free(inbuf.i_buf);
 	return 1;
 }
 
@@ -891,50 +1315,110 @@ PP(const char *name;)
 }
 
 
-/* ppputl - put a character to the current output line */
-/*      Checks for line overflow.*/
-VOID ppputl(P(int) c)
-PP(int c;)
+/*
+ * growl - make the line buffer longer
+ */
+static VOID growl(NOTHING)
 {
-	if (linep < &line[LINESIZE])
-	{
-		*linep++ = c;
-	} else if (!loverflow)
+	register long l;
+
+	l = linep - line;
+	if ((line = lrealloc(line, l + LINESIZE)) == NULL)
 	{
-		loverflow++;
 		error(_("line overflow"));
+		cexit();
 	}
+	linep = line + l;
+	lineend = linep + LINESIZE;
+}
+
+
+/* ppputl - put a character to the current output line */
+/*      The line buffer grows as needed.*/
+VOID ppputl(P(int) c)
+PP(int c;)
+{
+	if (linep >= lineend)
+		growl();
+	*linep++ = c;
 }
 
 
 /*
  * initl - initialize current line
- *      Sets the line pointer and the line overflow flag.
+ *      Sets the line pointer.
  */
 VOID initl(NOTHING)
 {
-	*(linep = &line[0]) = '\0';
-	loverflow = 0;
+	linep = line;
+	if (line == NULL)
+		growl();
+	*linep = '\0';
+}
+
+
+/*
+ * pbcopy - copy a TTEXT or TFAST token into the frame being filled
+ * returns what follows the token
+ */
+static const char *pbcopy(P(struct pbframe *) fp, P(const char *) p)
+PP(struct pbframe *fp;)
+PP(const char *p;)
+{
+	register const char *s;
+	register char *q;
+	register short *t;
+	register int l;
+
+	s = p + 1;
+	for (l = 0; s[l]; l++)
+		;
+	if (fp->f_pos + l > fp->f_size)
+		pbroom(fp, fp->f_pos + l);
+	q = &fp->f_buf[fp->f_pos];
+	t = &fp->f_tlen[fp->f_pos];
+	fp->f_pos += l;
+	t[0] = *p == TFAST ? l : 0;
+	while (--l > 0)
+	{
+		*q++ = *s++;
+		*++t = 0;
+	}
+	*q = *s++;
+	return s + 1;
+}
+
+
+/*
+ * pbputc - put a character of a string into the frame being filled
+ */
+static VOID pbputc(P(struct pbframe *) fp, P(int) c)
+PP(struct pbframe *fp;)
+PP(int c;)
+{
+	pbroom(fp, fp->f_pos + 1);
+	fp->f_tlen[fp->f_pos] = 0;
+	fp->f_buf[fp->f_pos++] = c;
 }
 
 
 /*
  * expand - expands the macro definition
- *  Checks for define recursion and #define x x problems, collects
- *  the actual arguments using getaarg, and then expands the macro
- *  by pushing it onto the push back buffer, substituting arguments
- *  as it goes.
+ *  Checks for define recursion, collects the actual arguments using
+ *  getaarg, and then expands the macro by pushing a frame with the
+ *  tokens of its body onto the push back stack, substituting the
+ *  tokens of the arguments as it goes.
  */
 VOID expand(P(struct symbol *) sp)
 PP(struct symbol *sp;)
 {
-	char argbuf[ARGBSIZE];
-	char *args[MAXARGS];
+	long abeg[MAXARGS + 1];				/* argument i is abuf[abeg[i]] to abuf[abeg[i+1]] */
 	char token[TOKSIZE];
 	register const char *p;
-	register char *abp;
+	register const char *a;
 	register const char *mdef;
-	register int i, j, nargs, type;
+	register int i, j, k, nargs, type;
+	register struct pbframe *fp;
 
 	if (pbflag++ > 100)
 	{
@@ -942,13 +1426,8 @@ PP(struct symbol *sp;)
 		return;
 	}
 	mdef = defap + sp->s_def;
-	if (strcmp(sp->s_name, mdef) == 0)
-	{									/* handle #define x x */
-		while (*mdef)
-			ppputl(*mdef++);
-		return;
-	}
 	nargs = 0;
+	abeg[0] = 0;
 	if (*mdef == NOARGS)				/* suppress grabbing of args */
 	{
 		;
@@ -957,57 +1436,77 @@ PP(struct symbol *sp;)
 		pbtok(token);
 	} else
 	{
-		abp = &argbuf[0];
-		while ((type = getaarg(token)) != CEOF)
+		abused = 0;
+		while ((type = getaarg()) != CEOF)
 		{
 			if (nargs >= MAXARGS)
 			{
 				error(_("too many arguments"));
 				return;
 			}
-			args[nargs++] = abp;
-			for (p = token; (*abp++ = *p++) != 0; )
-			{
-				if (abp >= &argbuf[ARGBSIZE])
-				{
-					error(_("argument buffer overflow"));
-					return;
-				}
-			}
+			abeg[++nargs] = abused;
 			if (type == RPAREN)
 				break;
 		}
 	}
-	if (*mdef == NEWLABEL)
-	{
-		clabel = nlabel;
-		if (!nargs)
-			nlabel++;
-		else
-			nlabel += atoi(args[0]);
-	} else if (*mdef == LABEL)
+	if (*mdef == NEWLABEL || *mdef == LABEL)
 	{
-		if (!nargs)
-			i = clabel;
-		else
-			i = clabel + atoi(args[0]);
-		pbnum(i);
-		pbtok("_L");
-	} else
+		i = 0;
+		if (nargs)
+		{								/* the first argument, as a number */
+			for (a = abuf, i = 0; a < abuf + abeg[1] && i < TOKSIZE - 1; a++)
+				for (a++; *a && i < TOKSIZE - 1; a++)
+					token[i++] = *a;
+			token[i] = '\0';
+			i = atoi(token);
+		}
+		if (*mdef == NEWLABEL)
+		{
+			clabel = nlabel;
+			nlabel += nargs ? i : 1;
+		} else
+		{
+			pbnum(clabel + i);
+			pbtok("_L");
+		}
+		return;
+	}
+
+	mdef++;								/* skip no. of args */
+	fp = pbframe((int) abeg[nargs] + PBSIZE);
+	for (p = mdef; (k = *p) != 0;)
 	{
-		mdef++;							/* skip no. of args */
-		for (p = mdef + strlen(mdef) - 1; p >= mdef; p--)
+		if (k == TTEXT || k == TFAST)
 		{
-			if (*p == ARG)
-			{
-				if ((j = *--p) <= nargs)
-					pbtok(args[j - 1]);
-			} else
+			p = pbcopy(fp, p);
+		} else if (k == TARG)
+		{
+			if ((j = p[1]) <= nargs)
+				for (a = abuf + abeg[j - 1]; a < abuf + abeg[j];)
+					a = pbcopy(fp, a);
+			p += 3;
+		} else
+		{
+			for (p++; *p; p++)
 			{
-				putback(*p);
+				if (*p == ARG && (j = *++p) != ARG)
+				{
+					if (j > nargs)
+						continue;
+					for (a = abuf + abeg[j - 1]; a < abuf + abeg[j]; a++)
+						for (a++; *a; a++)
+							pbputc(fp, *a);
+				} else
+				{
+					pbputc(fp, *p);
+				}
 			}
+			p++;
 		}
 	}
+	if ((fp->f_len = fp->f_pos) == 0)
+		pbdepth--;						/* nothing to put back */
+	fp->f_pos = 0;
 }
 
 
@@ -16,7 +16,8 @@ int asflag;
 int aesflag;
 char *source;			/* preprocessor source file */
 char dest[MAXPSIZE];		/* preprocessor destination file */
-FILE *inbuf, *outbuf;
+struct infile inbuf;
+FILE *outbuf;
 
 static int ndefs;
 static char stdincl[MAXPSIZE];
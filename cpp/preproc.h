@@ -12,6 +12,11 @@
 
 #include "../util/util.h"
 
+#ifndef __ALCYON__
+#  define lmalloc(size) malloc(size)
+#  define lrealloc(ptr, size) realloc(ptr, size)
+#endif
+
 #define _(x) x
 
 /* cexpr operators */
@@ -63,6 +68,7 @@
 #define	ENDIF		7
 #define	IF			8
 #define LINE		9
+#define PRAGMA		10
 
 /* Magic Numbers used in Macros */
 #define	ARG			-1
@@ -74,15 +80,20 @@
 #define	SKIP		0
 #define	NOSKIP		1
 
+/* How far an include file looks like #ifndef X ... #endif */
+#define	GNONE		0				/* nothing seen yet */
+#define	GIN			1				/* inside #ifndef X */
+#define	GOUT		2				/* past the matching #endif */
+#define	GBAD		3				/* something outside the guard */
+
 /* General Defines */
 #define	SOH			'\01'
-#define	SSIZE		22
-#define	LINESIZE	2048
+#define	LINESIZE	2048			/* line buffer grows by this much */
 #define	MAXARGS		60
-#define	ARGBSIZE	1000
+#define	ARGBSIZE	1000			/* argument buffer grows by this much */
 #define	TOKSIZE		1024
 #define	DEFSIZE		1024
-#define PBSIZE		2000
+#define PBSIZE		64				/* room in a frame for putback() */
 
 #ifndef FALSE
 #define TRUE		1
@@ -97,17 +108,26 @@
 #define NINCL       10
 #define LABSTART    1000
 
-#define	HSIZE	2048
+#define	HSIZE	1024				/* symbol table starts with this many chains */
 
 /* Symbol Table Entry structure */
 struct symbol {
-	char s_name[SSIZE];
+	struct symbol *s_next;		/* next in hash chain */
+	unsigned int s_hash;		/* strhash() of s_name */
 	long s_def;
+	char s_name[1];				/* the whole name, allocated with the entry */
+};
+
+/* an input file, read into memory whole */
+struct infile {
+	char *i_buf;				/* the file, with its line ends made '\n' */
+	char *i_ptr;				/* next character */
+	char *i_end;				/* end of the file */
 };
-extern struct symbol symtab[HSIZE];
+extern struct infile inbuf;		/* the file being read */
 
 /* buffered I/O structure */
-extern FILE *inbuf, *outbuf;
+extern FILE *outbuf;
 
 /* command line define structure */
 struct defstruc {
@@ -119,9 +139,13 @@ extern struct defstruc defs[NDEFS];
 #define	FSTACK	 10
 #define MAXPSIZE 128
 struct stackstruc {
-	FILE *ifd;
+	struct infile ibuf;			/* the includer's input, to go back to */
 	char ifile[MAXPSIZE];
 	int lineno;
+	char *cbase;				/* condition stack when ifile was opened */
+	int gstate;					/* guard state of ifile */
+	char *gname;				/* its guard macro */
+	int once;					/* it had #pragma once */
 };
 extern struct stackstruc filestack[FSTACK], *filep;		/* stack of incl files, ptr to... */
 
@@ -139,14 +163,24 @@ extern char *source;			/* preprocessor source file */
 extern char dest[MAXPSIZE];		/* preprocessor destination file */
 
 /* line to output after macro substitution */
-extern char line[LINESIZE+2];				/* line buffer */
+extern char *line;							/* line buffer */
 extern char *linep;							/* current line pointer */
-extern int loverflow;						/* line overflow flag */
 extern int lineno;
 
-/* push back buffer */
-extern char pbbuf[PBSIZE];					/* push back buffer */
-extern char *pbp;							/* push back pointer */
+/*
+ * push back stack: each frame holds characters to be read again, a
+ * macro expansion or what putback() gave back.  f_tlen is nonzero
+ * where gettok() can take a whole token without looking at it again.
+ */
+struct pbframe {
+	char *f_buf;				/* the characters */
+	short *f_tlen;				/* length of the token starting here, or 0 */
+	int f_pos;					/* next character */
+	int f_len;					/* end of the characters */
+	int f_size;					/* room in f_buf */
+};
+extern struct pbframe *pbstack;				/* push back stack */
+extern int pbdepth;							/* frames on it */
 extern int pbflag;							/* checks for recursive definition */
 
 /* Function declarations */
@@ -162,13 +196,17 @@ long constexpr PROTO((const char *str));
  */
 extern char const ctype[];
 
-VOID symcopy PROTO((const char *sym1, char *sym2));
+unsigned int strhash PROTO((const char *s));
+VOID symclear PROTO((NOTHING));
 VOID error PROTO((const char *s, ...)) __attribute__((format(printf, 1, 2)));
 VOID warning PROTO((const char *s, ...)) __attribute__((format(printf, 1, 2)));
 VOID putback PROTO((int c));
 VOID pbtok PROTO((const char *s));
+VOID pbroom PROTO((struct pbframe *fp, int n));
+struct pbframe *pbframe PROTO((int n));
 int ngetch PROTO((NOTHING));
 struct symbol *getsp PROTO((const char *name));
+int tokfast PROTO((const char *s, int next));
 int gettok PROTO((char *token));
 int getstr PROTO((char *str, int nchars, char endc));
 struct symbol *lookup PROTO((const char *name));
@@ -180,6 +218,7 @@ extern int nincl;
 extern char *incl[NINCL];
 
 VOID putid PROTO((const char *fname, int lnum));
+VOID inclend PROTO((struct stackstruc *fp));
 int kwlook PROTO((const char *name));
 VOID ppputl PROTO((int c));
 VOID initl PROTO((NOTHING));
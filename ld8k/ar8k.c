@@ -78,12 +78,15 @@ void skip(void);
 void puthead(int f);
 void append(int f);
 void chmagic(int f);
+int  isdir(void);
+void symdir(void);
 
 
 int main(int argc, char **argv)
 {
 	int i;
 	char *cp;
+	char name[sizeof head.ar8k_name + 1];	/* member name, terminated */
 
 	if( argc < 3 ){
 		printf("usage:  ar8k  key  archfile [files ...]\n");
@@ -148,11 +151,16 @@ case 'x':
 		}
 		append( arfile );
 		close(arfile);
+		symdir();
 		exit(0);
 	}
 
 	while( read( arfile, (char *) &head, sizeof head ) == sizeof head ){
 		swap_ar(&head);
+		if( isdir() ){  /* never copied, symdir() rebuilds it */
+			skip();
+			continue;
+		}
 
 		switch( key ){
 
@@ -187,8 +195,10 @@ case 't':
 			break;
 
 case 'x':
+			memcpy( name, head.ar8k_name, sizeof head.ar8k_name );
+			name[sizeof head.ar8k_name] = 0;
 			if( (filcnt == 0 || inlist()) &&
-			    (file=creatb(head.ar8k_name,0666)) >=0 ){
+			    (file=creatb(name,0666)) >=0 ){
 				comment("extracting");
 				copy( file , ODD , arfile , EVEN );
 				close( file );
@@ -226,6 +236,7 @@ case 'd':
 		close(tpfile);
 		unlink(tmpname);
 	}
+	if( key == 'd' || key == 'r' ) symdir();
 	return 0;
 }
 
@@ -399,3 +410,125 @@ void chmagic(int f)
 	read( f , (char *) &mag , 2 );
 	if( ntohs(mag) != AR8KMAGIC ) errex("%s is not an archive",archive);
 }
+
+
+int isdir(void)
+{
+	return( strncmp( head.ar8k_name, AR8KDIR, sizeof head.ar8k_name ) == 0 );
+}
+
+
+/*
+ * symdir - Rewrite the archive with a fresh symbol directory as its
+ * first member.  Every x.out member contributes its global symbols;
+ * members that are not x.out modules are carried along unindexed.
+ */
+void symdir(void)
+{
+	struct x_hdr xh;
+	struct x_sym *syms = NULL;
+	struct ar8k_sym *dir = NULL;
+	int32_t *mempos = NULL;
+	short *dirmem = NULL;
+	long start, size, pos, dirsiz;
+	int i, n, nmem = 0, nsym = 0, maxmem = 0, maxsym = 0;
+
+	arfile = openb( archive , 0 );
+	if( arfile < 0 ) return;
+	chmagic( arfile );
+
+	/* collect the global symbols of every member */
+	while( read( arfile, (char *) &head, sizeof head ) == sizeof head ){
+		swap_ar(&head);
+		if( isdir() ){
+			skip();
+			continue;
+		}
+		if( nmem >= maxmem ){
+			maxmem = maxmem ? 2*maxmem : 64;
+			mempos = realloc( mempos, maxmem * sizeof *mempos );
+			if( mempos == NULL ) errex("out of memory");
+		}
+		size = head.ar8k_size;
+		if( size & 1 ) size++;
+		mempos[ nmem ] = size;
+		start = lseek( arfile , 0L , 1 );
+		if( head.ar8k_size >= (long)sizeof xh &&
+		    read( arfile, (char *) &xh, sizeof xh ) == sizeof xh ){
+			swap_hdr( &xh );
+			if( (xh.x_magic & 0xfff0) == X_SU_MAGIC && xh.x_symb > 0 &&
+			    lseek( arfile, xh.x_nseg * sizeof( struct x_sg ) +
+					xh.x_init + xh.x_reloc, 1 ) != -1 ){
+				syms = realloc( syms, xh.x_symb );
+				if( syms == NULL ) errex("out of memory");
+				if( read( arfile, (char *) syms, xh.x_symb ) != xh.x_symb )
+					errex("bad symbol table in %-14.14s",head.ar8k_name);
+				n = xh.x_symb / sizeof( struct x_sym );
+				for( i=0; i<n; i++ ){
+					if( syms[i].x_sy_fl != X_SY_GLB ) continue;
+					if( nsym >= maxsym ){
+						maxsym = maxsym ? 2*maxsym : 256;
+						dir = realloc( dir, maxsym * sizeof *dir );
+						dirmem = realloc( dirmem, maxsym * sizeof *dirmem );
+						if( dir == NULL || dirmem == NULL )
+							errex("out of memory");
+					}
+					memcpy( dir[nsym].ar8k_sy_name, syms[i].x_sy_name, XNAMELN );
+					dirmem[ nsym++ ] = nmem;
+				}
+			}
+		}
+		lseek( arfile , start + size , 0 );
+		nmem++;
+	}
+
+	/* members follow the directory; turn their sizes into offsets */
+	dirsiz = nsym * sizeof( struct ar8k_sym );
+	pos = 2;
+	if( nsym ) pos += sizeof head + dirsiz;
+	for( i=0; i<nmem; i++ ){
+		size = mempos[ i ];
+		mempos[ i ] = pos;
+		pos += sizeof head + size;
+	}
+	for( i=0; i<nsym; i++ ){
+		dir[ i ].ar8k_sy_pos = mempos[ dirmem[i] ];
+		swap_arsym( &dir[ i ] );
+	}
+
+	settmp();
+	if( nsym ){
+		memset( &head, 0, sizeof head );
+		strncpy( head.ar8k_name, AR8KDIR, sizeof head.ar8k_name );
+		head.ar8k_mode = 0644;
+		head.ar8k_size = dirsiz;
+		puthead( tpfile );
+		if( write( tpfile, (char *) dir, dirsiz ) != dirsiz )
+			errex("bad write");
+	}
+	lseek( arfile, 2L, 0 );
+	while( read( arfile, (char *) &head, sizeof head ) == sizeof head ){
+		swap_ar(&head);
+		if( isdir() ){
+			skip();
+			continue;
+		}
+		puthead( tpfile );
+		copy( tpfile , EVEN , arfile , EVEN );
+	}
+	close( arfile );
+
+	arfile = creatb( archive , 0666 );
+	if( arfile < 0 ) errex("cannot create %s",archive);
+	lseek( tpfile , 0L , 0 );
+	while( (i = read( tpfile , buffer , 512)) > 0 )
+		if( write( arfile , buffer , i ) != i )
+			errex("botch in recopying the archive");
+	close( arfile );
+	close( tpfile );
+	unlink( tmpname );
+	free( syms );
+	free( dir );
+	free( dirmem );
+	free( mempos );
+}
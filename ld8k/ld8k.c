@@ -10,14 +10,23 @@
  *   - Standard C headers
  */
 
+#define _GNU_SOURCE	/* for O_TMPFILE */
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
 #include "xout.h"
 
+#ifdef __APPLE__
+#define st_mtim st_mtimespec
+#endif
+
 #define uns unsigned int
 #define reg register
 
@@ -43,20 +52,19 @@ static int creatb(const char *name, int mode)
 /* this is the Z8000 loader -- it uses as input and output
    x.out format modules -- see ld8k.man for details */
 
-#define MODNO 256	/* max allowable modules per load */
-#define MAPNO 512	/* max map entries per load */
-#define SYMPNO 8192	/* total number of symbols in all modules */
-#define SEGNO 128	/* max number of segments per module */
-#define FILNO 128	/* max number of files to process */
-#define POSNO 256	/* max number of items in libraries */
-#define SYMNO 2048	/* max number of symbols (total!) */
-#define SEGHASH 128	/* max number of segment names */
-#define SYMHASH 1024	/* max number of external symbols */
+#define SEGNO 128	/* number of output segments (7 bit segment numbers) */
+#define MSEGNO 256	/* max number of segments per module (8 bit numbers) */
 
 #define AR8SIZ sizeof( struct ar8k_hd )
 #define XHSIZ sizeof( struct x_hdr )
 #define RLC 64
 #define RSIZ (RLC * sizeof( struct x_rel ))
+#define RLMAX 65536L	/* -r relocation items kept in memory at most */
+
+#define OF_XOUT	0	/* output formats for -F */
+#define OF_BIN	1	/* flat binary */
+#define OF_IHEX	2	/* Intel HEX */
+#define OF_CMD	3	/* x.out as CP/M-8000 loads it: no relocation or symbols */
 
 #define islower(c) ((c)>= 'a' && (c)<= 'z')
 #define isupper(c) ((c)>= 'A' && (c)<= 'Z')
@@ -68,26 +76,36 @@ static int creatb(const char *name, int mode)
 #define X_SG_UND 0
 
 #define round(x) if((x)&1)(x)++
+/* the data of a segment of type t is in the file (z from segdata()) */
+#define indata(t,z) (idata[t] || (z) && (t) == X_SG_UND)
 
 
 /* now we define the data structures we will use */
 
 struct ar8k_hd	ar8k_hd;		/* header from the old archive */
 
-/* segment map structures */
+/* segment map structures; these, like the other tables, grow as needed */
 
-short	modmap[MODNO],
-	modsym[MODNO],
+int	*modmap,
+	*modsym,
 	modno;
 
-char	map[MAPNO];
-short	symap[SYMPNO];
+char	*map;
+int	*symap;
 
-short	mapx,
+int	mapx,
 	maps,
 	symx,
 	syms;
 
+int	nmodmap,	/* allocated sizes of the tables */
+	nmodsym,
+	nmap,
+	nsymap,
+	nfiltab,
+	npostab,
+	nsymtab;
+
 
 struct segtab {
 	long	segsiz;
@@ -100,32 +118,63 @@ struct segtab {
 	segtab[SEGNO];
 
 
-short	seghash[SEGHASH];
-short	symhash[SYMHASH];
+/* open hash tables of symtab indices, kept at most 3/4 full */
+
+struct htab {
+	int	*slot;		/* symtab index, 0 if empty */
+	int	size;		/* a power of two */
+	int	count;
+}
+	seghash,
+	symhash;
+
+struct htab	*hcur;		/* where lookup() last missed */
+int	hslot;
 
 struct x_hdr	x_hdr;
-struct x_sg	x_sg[SEGNO];
+struct x_sg	x_sg[MSEGNO];
 
 struct filtab {
 	char	*filname;
-	short	posndx;
+	int	posndx;
+}
+	*filtab;
+int	filndx;
+
+long	*postab;
+int	posmax;
+
+
+/* symbol directory of the archive being searched, if it has one */
+
+struct ar8k_sym	*ardir;		/* directory entries, in member order */
+int	*arname,		/* entry numbers sorted by symbol name */
+	*armem;			/* member number of each entry */
+struct armem {
+	long	pos;		/* offset of the member header */
+	int	first;		/* its first directory entry */
+	int	nsym;		/* number of entries it owns */
+	char	state;		/* AM_IDLE, AM_WANT or AM_DONE */
 }
-	filtab[FILNO];
-short	filndx;
+	*armtab;
+int	ardirn,
+	armemn;
 
-long	postab[POSNO];
-short	posmax;
+#define AM_IDLE	0	/* defines nothing currently undefined */
+#define AM_WANT	1	/* may resolve an undefined symbol */
+#define AM_DONE	2	/* loaded, or unusable in this load */
 
 
 /* the main symbol table */
 
-struct x_sym symtab[SYMNO];
+struct x_sym *symtab;
 
-short	symlev = 1,
+int	symlev = 1,
 	symtop;
 
 struct x_rel	rlibuf[RLC],
-		rlobuf[RLC];
+		*rlobuf;	/* -r relocation items not yet written to relfile */
+int	nrlobuf;
 
 /* the type clash and mixing table */
 
@@ -154,7 +203,7 @@ char	idata[] = { 0, 0, 0, 1, 1, 1, 1, 1 };
 
 /*	control for preassigned segment types */
 
-char	prelist[64];
+char	prelist[SEGNO];
 int	prex;
 
 
@@ -165,12 +214,173 @@ char	*objname = "x.out",
 	libname[64],
 	*fname,
 	*ap,
-	line[128],
-	buf[512];
+	line[128];
+
+/* pass2 works on memory: the input file is mapped, the output built up */
+
+char	*inmap,		/* the input file being loaded */
+	*image,		/* header, segment table and initialized data */
+	*sgp;		/* next segment descriptor in image */
+long	inpos,		/* next byte to take from inmap */
+	insiz,
+	imgsiz;
+int	inmapped;	/* inmap came from mmap(), not malloc() */
+
+struct inmaps {		/* inputs kept mapped until pass2 is done */
+	char	*map;
+	long	siz;
+	int	mapped;
+}
+	*inmaps;
+int	ninmaps,
+	ninmapt;
+
+/* each module placed by pass2, to be copied and relocated by p2apply() */
+
+struct p2seg {
+	char	*data;		/* its initialized data in inmap, or NULL */
+	uns	len;
+	uns	siz;		/* offset of the module in the output segment */
+	uns	rel;		/* relocation constant for the segment */
+	long	pos;		/* where its data goes in image */
+	char	dead;		/* left out by -g */
+}
+	*p2seg;
+struct p2mod {
+	char	*name;		/* file name, for messages */
+	int	maps,		/* its slices of map and symap */
+		syms;
+	int	seg,		/* its first p2seg entry */
+		nseg;
+	char	*rel;		/* its relocation items in inmap */
+	long	nrel;
+	struct x_rel *out;	/* the items as rewritten for -r */
+	int	ovfl;		/* short segment offsets that overflowed */
+	int	badsg;		/* items for a segment it does not have */
+	long	nrt[8];		/* items done, by type; [0] for notes */
+}
+	*p2mod;
+int	p2modn,
+	np2mod,
+	p2segn,
+	np2seg,
+	p2next,			/* next module for a worker to take */
+	nthread = 1;
+pthread_mutex_t	p2lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* what -k keeps in objname.lks for the next link; see relink() */
+
+#define LKSMAGIC 0x6C6B7332L		/* "lks2" */
+#define FNVINIT 0xcbf29ce484222325ULL
+
+struct lkstamp {
+	long	size,
+		sec,
+		nsec;
+};
+struct lkhdr {
+	long	magic;
+	uint64_t sum;		/* cfgsum() of the link */
+	struct lkstamp out;	/* objname as it was left */
+	long	imgsiz;
+	int	filndx,
+		posmax,
+		symlev,
+		mapx,
+		symx,
+		modno;
+};
+struct lkfile {
+	struct lkstamp stamp;
+	int	posndx;
+}
+	*lkfile;
+struct lkmod {			/* one per module, in pass2 order */
+	int	file;		/* its filtab index */
+	long	fpos;		/* offset of its header in the file */
+	uint64_t lay,		/* lkhash() of its layout */
+		dat;		/* and of its contents */
+	int	dirty;		/* contents changed since */
+}
+	*lkmod;
+struct lkadv {			/* one per module segment, as map */
+	uns	siz,		/* what p2load() added to its segsiz */
+		pos;		/* and to its segpos */
+}
+	*lkadv;
+struct segtab	lkseg[SEGNO];	/* segtab as interlude() left it */
+char	*lksname;
+uint64_t lksum;
+/* jp and call that -b turned into jr and calr, in address order */
+
+struct rlx {
+	long	a,		/* old address of the instruction */
+		pos,		/* where it is in image */
+		t;		/* old address of its target */
+	uint16_t op;		/* the jp or call */
+	int	seg;		/* output segment */
+	char	on;		/* relaxed */
+}
+	*rlx;
+struct x_rel	*rlxadr;	/* a module's address items, by place */
+int	*rlxcnt,		/* number relaxed before each one */
+	nrlxadr,
+	rlxn,
+	nrlx,
+	nrlxcnt,
+	relax;			/* -b */
+
+/* sections for -g: one entry for each module segment, indexed like map */
+
+struct gcsec {
+	uns	len;		/* its length, rounded up */
+	uns	cut;		/* bytes left out before it in its segment */
+	char	live;
+}
+	*gcsec;
+struct gcedge {			/* a reference out of a section */
+	int	from,
+		to;		/* a section, or ~symbol for an undefined one */
+}
+	*gcedge;
+int	*gcsym,			/* 1 + the section of each symbol, or 0 */
+	ngcsec,
+	ngcedge,
+	ngcsym,
+	gcn,
+	gcu,			/* symbols below this one came from -u */
+	gc;			/* -g */
+
+/* what --stats=json reports */
+
+#define ST_PASS0	0
+#define ST_PASS1	1
+#define ST_INTER	2
+#define ST_PASS2	3
+#define ST_OUT		4
+#define ST_NPH		5
+
+char	*stname[ST_NPH] = { "pass0", "pass1", "interlude", "pass2", "output" };
+double	sttime[ST_NPH],		/* seconds spent in each phase */
+	stlast;			/* when the last phase ended */
+long	strt[8],		/* relocation items, by type as in p2mod */
+	arpass,			/* archive passes */
+	arprobe,		/* members looked at */
+	arload;			/* and loaded */
+struct segtab	stseg[SEGNO];	/* segtab before finale() clears it */
+int	*stsym,			/* symtab indices by address */
+	nstsym,
+	statf;			/* --stats=json */
+
+int	incr,			/* -k */
+	lkrelink,		/* pass2 is only redoing changed modules */
+	nlkfile,
+	nlkmod,
+	nlkadv,
+	p2file;			/* filtab index of the file pass2 is on */
 
 int	objfile,
-	objifile,
-	relfile,
+	relfile = -1,		/* -r scratch file, once rlobuf fills */
 	symfile,
 	infile,
 	errcnt,
@@ -182,45 +392,84 @@ int	objfile,
 	shared,
 	mapf,
 	rlo,
-	dirty,
-	blen,
 	strip,
 	objnseg,
 	nolocal,
+	outfmt,
 	saverel;
 
-uns	segrel[SEGNO],
-	segsiz[SEGNO];
+uns	segrel[MSEGNO];
 
 long	stacksiz,
-	segpos[SEGNO],
 	relpos,
 	relval,
 	relvalc,
-	bpos = 1;
+	relcnt;
 
 
-short	*hpos;		/* pointer into hash table for next insertion */
-
 /* forward declarations */
 void pass0(int argc, char **argv);
 void pass1(void);
 void p1entry(int n);
+void p1scan(int n);
+void p1index(int n);
+int  p1member(int n, long fpos);
+int  rddir(void);
+int  arcmp(const void *a, const void *b);
+void armark(char *sym);
+int  arneed(struct armem *mp);
+int  armagic(void);
 void p1load(void);
 void p1doseg(void);
 void p1dosym(void);
 int  trysim(void);
 int  symread(void);
+void gcdef(int j, int sec);
+void gcmark(void);
+void gcread(void);
+void gcload(void);
+void gcadd(int from, int to);
+int  gccmp(const void *a, const void *b);
 void interlude(void);
 void interpos(int i);
 void loadmap(void);
 void pass2(void);
 void p2read(int n);
 void p2load(void);
-void p2dorel(void);
-void reloc(struct x_rel *rlp);
+void p2run(void);
+void *p2work(void *arg);
+void p2apply(struct p2mod *mp);
+void p2done(struct p2mod *mp);
+void reloc(struct p2mod *mp, struct x_rel *rlp);
+void p2relax(void);
+int  relcmp(const void *a, const void *b);
+int  rlxcmp(const void *a, const void *b);
+long rlxmove(long x);
+void renote(long a, char *p, int kind);
+void p2squeeze(void);
 void finale(void);
 void finout(int i);
+void finimg(void);
+void hexrec(FILE *fp, int n, uns a, int typ, char *p);
+int  ofmt(char *s);
+double stclock(void);
+void stmark(int i);
+void stats(struct segtab *sp, int relinked);
+int  stcmp(const void *a, const void *b);
+long staddr(struct segtab *sp);
+void jsname(char *s, int n);
+uint64_t cfgsum(void);
+int  lkhash(struct lkmod *lp, long start);
+int  segdata(struct x_hdr *hp, struct x_sg *sg);
+int  relink(void);
+void lkread(void);
+void lksave(void);
+int  lkget(FILE *fp, void *p, long n);
+int  lkput(FILE *fp, void *p, long n);
+void lkstamp(struct stat *st, struct lkstamp *sp);
+int  lksame(struct stat *st, struct lkstamp *sp);
+char *filpath(int i);
+uint64_t hashmem(uint64_t h, char *p, long n);
 void dodline(char *s);
 void dodset(int i, int typ);
 void dodfile(char *s);
@@ -228,12 +477,19 @@ void append(char *s);
 void err(const char *s, ...);
 void errex(const char *s, ...);
 int  findseg(int typ, uns siz);
-void flshbuf(void);
-void getbuf(long p);
+char *inread(long n);
+void inopen(void);
+void inkeep(void);
+void inclose(void);
 int  idmatch(char *a, char *b);
 int  install(char *s);
-int  lookup(short *htab, int HTAB, char *sym);
-int  mk_outfile(char *s);
+int  lookup(struct htab *h, char *sym);
+void hadd(int j);
+void hsize(struct htab *h, int n);
+unsigned hashname(char *s);
+void *grow(void *t, int *np, long n, size_t sz);
+void mapgrow(long n);
+int  mk_tmpfile(void);
 void putrel(struct x_rel *rlp);
 int  rdhead(void);
 void setstack(char *s);
@@ -250,12 +506,36 @@ int main(int argc, char **argv)
 		fprintf(stderr,"usage:  ld8k [flags]  file [file...]\n");
 		exit(0);
 	}
-	for( i=0; i < MAPNO; i++ ) map[ i ] = 255;
+	mapgrow( 0 );
+	stlast = stclock();
 
 	pass0(argc,argv);
+	stmark( ST_PASS0 );
+	gcu = symlev;
+	if( saverel ) gc = 0;
+	if( saverel && outfmt ) errex( "-F is for executables, not -r" );
+	if( statf && mapf ) errex( "--stats=json and -m both write on stdout" );
+	if( outfmt == OF_CMD ) strip = 1;
+	if( saverel || relax || gc || outfmt == OF_BIN || outfmt == OF_IHEX )
+		incr = 0;
+	if( incr ){
+		lksname = malloc( strlen( objname ) + 5 );
+		if( lksname == NULL ) errex( "out of memory" );
+		strcat( strcpy( lksname, objname ), ".lks" );
+		lksum = cfgsum();
+		if( relink() ){
+			stmark( ST_PASS2 );
+			if( statf ) stats( segtab, 1 );
+			exit( 0 );
+		}
+	}
 	pass1();
+	if( gc && !errcnt ) gcmark();
+	stmark( ST_PASS1 );
 	interlude();
-	if( mapf ) loadmap();
+	if( incr ) memcpy( lkseg, segtab, sizeof lkseg );
+	if( !nonseg || saverel || splitid ) relax = 0;
+	if( mapf && !relax ) loadmap();
 	if( udefcnt && !saverel ){
 		err("\n%d undefined symbols:\n\n",udefcnt);
 		for( i=1; i<symlev; i++ )
@@ -263,17 +543,25 @@ int main(int argc, char **argv)
 				fprintf(stderr,"%-8.8s\n",symtab[i].x_sy_name);
 	}
 	if( errcnt ) errex( "pass1" );
-	objfile = mk_outfile( objname );
+	stmark( ST_INTER );
+	objfile = creatb( objname , 0666 );
 	if( objfile < 0 ) errex( "can't create %s" , objname );
-	objifile = objfile;
-	if( saverel ) relfile = mk_outfile( "relxxxx" );
+	imgsiz = relpos;
+	image = calloc( imgsiz, 1 );
+	if( image == NULL ) errex( "out of memory for %s", objname );
 	pass2();
+	if( mapf && relax ) loadmap();
 	if( errcnt ){
 		close( objfile );
 		creatb( objname , 0666 );
 		errex( "pass2" );
 	}
+	if( statf ) memcpy( stseg, segtab, sizeof stseg );
+	stmark( ST_PASS2 );
 	finale();
+	stmark( ST_OUT );
+	if( statf ) stats( stseg, 0 );
+	if( incr ) lksave();
 	exit( 0 );
 }
 
@@ -289,12 +577,25 @@ void pass0(int argc, char **argv)
 			switch( *++cp ){
 
 case 0:				break;
+case '-':			if( strcmp( cp, "-stats=json" ) == 0 )
+					statf++;
+				else
+					err( "bad flag: '%s'", argv[i] );
+				break;
+case 'b':			relax++;  continue;
 case 'd':			if( *++cp )	dodline( cp );
 					else	dodfile( argv[ ++i ] );
 				break;
+case 'F':			outfmt = ofmt( argv[++i] );  continue;
+case 'g':			gc++;  continue;
 case 'h':			debug++;  continue;
 case 'i':			splitid++;  continue;
-case 'l':			if( filndx >= FILNO ) errex( "too many files" );
+case 'j':			if( i+1 >= argc ) errex( "-j wants a count" );
+				nthread = atoi( argv[++i] );
+				if( nthread < 1 ) nthread = 1;
+				continue;
+case 'k':			incr++;  continue;
+case 'l':			filtab = grow( filtab, &nfiltab, filndx, sizeof *filtab );
 				*--cp = '-';
 				filtab[filndx++].filname = cp;
 				break;
@@ -304,9 +605,9 @@ case 'o':			objname = argv[++i];  continue;
 case 'r':			saverel++;  continue;
 case 't':			setstack( argv[++i] );  continue;
 case 's':			strip++;  continue;
-case 'u':			j = lookup(symhash,SYMHASH,argv[++i]);
+case 'u':			j = lookup( &symhash, argv[++i] );
 				if( j == -1 ){
-					*hpos = install( argv[i] );
+					hadd( install( argv[i] ) );
 					udefcnt++;
 				}
 				continue;
@@ -322,7 +623,7 @@ default:			err( "bad flag: '%c'" , *cp );
 			}
 			break;
 		} else {
-			if( filndx >= FILNO ) errex( "too many files" );
+			filtab = grow( filtab, &nfiltab, filndx, sizeof *filtab );
 			filtab[ filndx ].filname = cp;
 			filndx++;
 		}
@@ -383,39 +684,13 @@ void pass1(void)
 
 void p1entry(int n)
 {
-	reg int i;
-	long fpos;
-
 	if( !rdhead() ) return;
 	if( (uint16_t)x_hdr.x_magic == AR8KMAGIC ){  /* an archive! */
-		int changed, pass=0;
 		if( udefcnt == 0 ) return;
-		do {
-			if(debug) fprintf(stderr,"archive pass %d, udefcnt=%d\n", ++pass, udefcnt);
-			changed = 0;
-			i = 2;  /* sizeof magic word on disk */
-			fpos = i;
-			lseek( infile, fpos, 0 );
-			while( ((i = read( infile, &ar8k_hd, AR8SIZ)) == AR8SIZ )
-			    && ( ar8k_hd.ar8k_name[0] != '\0') ){
-				swap_ar(&ar8k_hd);
-				if( trysim() ){
-					if(debug) fprintf(stderr,"  LOADING member %.8s at fpos=%ld\n",
-						ar8k_hd.ar8k_name, fpos);
-					if( filtab[ n ].posndx <= 0 )
-						filtab[ n ].posndx = posmax+1;
-					postab[ ++posmax ] = fpos + AR8SIZ;
-					lseek( infile, fpos + AR8SIZ, 0 );
-					if( !rdhead() ) return;
-					p1load();
-					changed = 1;
-					if( udefcnt == 0 ) return;
-				}
-				fpos += AR8SIZ + ar8k_hd.ar8k_size;
-				round( fpos );
-				lseek( infile, fpos, 0 );
-			}
-		} while( changed && udefcnt > 0 );
+		if( rddir() )
+			p1index( n );
+		else
+			p1scan( n );
 		if( filtab[n].posndx > 0 ) ++posmax;
 		return;
 	}
@@ -426,6 +701,242 @@ void p1entry(int n)
 }
 
 
+/*
+ * p1scan - Search an archive without a symbol directory: read the symbol
+ * table of every member in turn, and go round again as long as loading
+ * one member made some other member needed.
+ */
+void p1scan(int n)
+{
+	reg int i;
+	long fpos;
+	int changed, pass=0;
+
+	do {
+		arpass++;
+		if(debug) fprintf(stderr,"archive pass %d, udefcnt=%d\n", ++pass, udefcnt);
+		changed = 0;
+		i = 2;  /* sizeof magic word on disk */
+		fpos = i;
+		lseek( infile, fpos, 0 );
+		while( ((i = read( infile, &ar8k_hd, AR8SIZ)) == AR8SIZ )
+		    && ( ar8k_hd.ar8k_name[0] != '\0') ){
+			swap_ar(&ar8k_hd);
+			arprobe++;
+			if( trysim() ){
+				if( !p1member( n, fpos ) ) return;
+				changed = 1;
+				if( udefcnt == 0 ) return;
+			}
+			fpos += AR8SIZ + ar8k_hd.ar8k_size;
+			round( fpos );
+			lseek( infile, fpos, 0 );
+		}
+	} while( changed && udefcnt > 0 );
+}
+
+
+/*
+ * p1index - Search an archive through its symbol directory.  Each
+ * undefined symbol is looked up once, when it first shows up in symtab,
+ * and marks the members defining it as wanted.  Wanted members are loaded
+ * in the order p1scan() would have found them, so both give the same load.
+ */
+void p1index(int n)
+{
+	reg int i;
+	reg struct armem *mp;
+	int next, cur, pass, loaded;
+
+	if(debug) fprintf(stderr,"archive directory: %d symbols in %d members\n",
+			ardirn, armemn);
+	next = 1;
+	cur = -1;
+	pass = loaded = 0;
+	for(;;){
+		/* the worklist: symbols entered since the last member loaded */
+		for( ; next < symlev; next++ )
+			if( symtab[ next ].x_sy_fl == X_SY_UNX )
+				armark( symtab[ next ].x_sy_name );
+		if( cur < 0 ){
+			arpass++;
+			if( debug ) fprintf(stderr,"archive pass %d, udefcnt=%d\n",
+				++pass, udefcnt);
+		}
+		for( i = cur+1; i < armemn; i++ )
+			if( armtab[ i ].state == AM_WANT ) break;
+		if( i >= armemn ){
+			if( !loaded ) return;
+			cur = -1;
+			loaded = 0;
+			continue;
+		}
+		cur = i;
+		mp = &armtab[ i ];
+		arprobe++;
+		if( !arneed( mp ) ){
+			mp->state = AM_IDLE;
+			continue;
+		}
+		mp->state = AM_DONE;
+		lseek( infile, mp->pos, 0 );
+		if( read( infile, &ar8k_hd, AR8SIZ ) != AR8SIZ ){
+			err( "bad archive member read in %s", fname );
+			return;
+		}
+		swap_ar( &ar8k_hd );
+		if( !rdhead() || !armagic() || !symread() ) continue;
+		if( !p1member( n, mp->pos ) ) return;
+		loaded = 1;
+		if( udefcnt == 0 ) return;
+	}
+}
+
+
+/*
+ * p1member - Load the archive member whose header is at fpos.  Its
+ * symbols have already been read by symread().
+ */
+int p1member(int n, long fpos)
+{
+	if(debug) fprintf(stderr,"  LOADING member %.8s at fpos=%ld\n",
+		ar8k_hd.ar8k_name, fpos);
+	arload++;
+	if( filtab[ n ].posndx <= 0 )
+		filtab[ n ].posndx = posmax+1;
+	postab = grow( postab, &npostab, posmax+2, sizeof *postab );
+	postab[ ++posmax ] = fpos + AR8SIZ;
+	lseek( infile, fpos + AR8SIZ, 0 );
+	if( !rdhead() ) return( 0 );
+	p1load();
+	return( 1 );
+}
+
+
+/*
+ * rddir - Read the symbol directory of the archive open on infile, if
+ * its first member is one.  Returns the number of entries.
+ */
+int rddir(void)
+{
+	reg int i, j;
+	long pos;
+
+	free( ardir );
+	free( arname );
+	free( armem );
+	free( armtab );
+	ardir = NULL;
+	arname = armem = NULL;
+	armtab = NULL;
+	ardirn = armemn = 0;
+
+	lseek( infile, 2L, 0 );
+	if( read( infile, &ar8k_hd, AR8SIZ ) != AR8SIZ ) return( 0 );
+	swap_ar( &ar8k_hd );
+	if( strncmp( ar8k_hd.ar8k_name, AR8KDIR, sizeof ar8k_hd.ar8k_name ) )
+		return( 0 );
+	i = ar8k_hd.ar8k_size / sizeof( struct ar8k_sym );
+	if( i == 0 ) return( 0 );
+	ardir = malloc( i * sizeof( struct ar8k_sym ) );
+	arname = malloc( i * sizeof( int ) );
+	armem = malloc( i * sizeof( int ) );
+	armtab = malloc( i * sizeof( struct armem ) );
+	if( !ardir || !arname || !armem || !armtab ) errex("out of memory");
+	if( read( infile, ardir, i * sizeof( struct ar8k_sym ) ) !=
+					i * sizeof( struct ar8k_sym ) ){
+		err( "bad archive directory read in %s", fname );
+		return( 0 );
+	}
+	ardirn = i;
+
+	/* entries come grouped by member, in archive order */
+	pos = -1;
+	for( i=0; i<ardirn; i++ ){
+		swap_arsym( &ardir[i] );
+		if( ardir[i].ar8k_sy_pos != pos ){
+			if( ardir[i].ar8k_sy_pos < pos ){
+				err( "archive directory out of order in %s", fname );
+				return( 0 );
+			}
+			pos = ardir[i].ar8k_sy_pos;
+			armtab[ armemn ].pos = pos;
+			armtab[ armemn ].first = i;
+			armtab[ armemn ].nsym = 0;
+			armtab[ armemn ].state = AM_IDLE;
+			armemn++;
+		}
+		j = armemn-1;
+		armtab[ j ].nsym++;
+		armem[ i ] = j;
+		arname[ i ] = i;
+	}
+	qsort( arname, ardirn, sizeof( int ), arcmp );
+	return( ardirn );
+}
+
+
+int arcmp(const void *a, const void *b)
+{
+	return( strncmp( ardir[ *(const int *)a ].ar8k_sy_name,
+			ardir[ *(const int *)b ].ar8k_sy_name, XNAMELN ) );
+}
+
+
+/*
+ * armark - Mark every member the directory lists as defining sym.
+ */
+void armark(char *sym)
+{
+	reg int lo, hi, mid, c;
+
+	lo = 0;
+	hi = ardirn;
+	while( lo < hi ){
+		mid = (lo+hi) >> 1;
+		c = strncmp( ardir[ arname[mid] ].ar8k_sy_name, sym, XNAMELN );
+		if( c < 0 ) lo = mid+1; else hi = mid;
+	}
+	for( ; lo < ardirn; lo++ ){
+		if( strncmp( ardir[ arname[lo] ].ar8k_sy_name, sym, XNAMELN ) )
+			break;
+		c = armem[ arname[lo] ];
+		if( armtab[ c ].state == AM_IDLE ) armtab[ c ].state = AM_WANT;
+	}
+}
+
+
+/*
+ * arneed - Does the member still define a symbol that is undefined?
+ * The directory stands in for the member's symbol table, as in trysim().
+ */
+int arneed(struct armem *mp)
+{
+	reg int i, k;
+
+	for( i = mp->first; i < mp->first + mp->nsym; i++ ){
+		k = lookup( &symhash, ardir[i].ar8k_sy_name );
+		if( k != -1 && symtab[k].x_sy_fl == X_SY_UNX )
+			return( 1 );
+	}
+	return( 0 );
+}
+
+
+/*
+ * armagic - Can the module whose header was just read join this load?
+ */
+int armagic(void)
+{
+	reg int i;
+
+	i = x_hdr.x_magic;
+	if( seg && i != X_SU_MAGIC && i != X_SX_MAGIC ) return( 0 );
+	if( nonseg && ( i==X_SU_MAGIC || i==X_SX_MAGIC) ) return( 0 );
+	return( 1 );
+}
+
+
 void p1load(void)
 {
 	if( (x_hdr.x_magic & 0xfff0) != X_SU_MAGIC ){
@@ -458,6 +969,10 @@ void p1doseg(void)
 	reg int i, j, k;
 	reg struct x_sg *xp;
 
+	if( x_hdr.x_nseg < 0 || x_hdr.x_nseg > MSEGNO ){
+		err("too many segments in %s", fname );
+		return;
+	}
 	i = x_hdr.x_nseg * sizeof( struct x_sg );
 	if( read( infile, x_sg, i ) != i ){
 		err("bad segment header read in %s", fname );
@@ -466,17 +981,18 @@ void p1doseg(void)
 	/* byte-swap all segment headers */
 	for( k=0; k < x_hdr.x_nseg; k++ ) swap_sg( &x_sg[k] );
 
-	if( modno >= MODNO ) errex("too many modules at %s",fname);
+	modmap = grow( modmap, &nmodmap, modno, sizeof *modmap );
+	modsym = grow( modsym, &nmodsym, modno, sizeof *modsym );
 	modmap[ modno ] = maps = mapx;
 	modsym[ modno++ ] = syms = symx;
 	mapx += x_hdr.x_nseg;
 	symx += (symtop-symlev);
-	if( mapx > MAPNO ) errex("map overflow in %s",fname);
-	if( symx > SYMPNO ) errex("symap overlow in %s",fname);
+	mapgrow( mapx );
+	symap = grow( symap, &nsymap, symx, sizeof *symap );
 
 	for( i = symlev; i < symtop; i++ ){
 		if( symtab[ i ].x_sy_fl == X_SY_SEG ){
-			j = lookup( seghash, SEGHASH, symtab[i].x_sy_name );
+			j = lookup( &seghash, symtab[i].x_sy_name );
 			if( j != -1 ){
 				map[maps+symtab[i].x_sy_sg] = symtab[j].x_sy_sg;
 				symap[syms + (i-symlev) ] = j;
@@ -493,6 +1009,10 @@ void p1doseg(void)
 		if( ( segtab[j].segsiz += xp->x_sg_len) >= 65536L )
 			err( "segment %d overflow in %s",j,fname);
 		round( segtab[j].segsiz );
+		if( gc ){
+			gcsec = grow( gcsec, &ngcsec, maps+k, sizeof *gcsec );
+			gcsec[ maps+k ].len = segtab[j].segsiz - segrel[ k ];
+		}
 	}
 }
 
@@ -500,27 +1020,28 @@ void p1doseg(void)
 void p1dosym(void)
 {
 	reg int i, j, k;
-	short symstt;
-	short discard;
-	short *syp;
+	int symstt, sec;
+	int *syp;
 
 	symstt = symlev;
 	for( i=symlev; i < symtop; i++ ){
 		syp = &symap[ syms + (i-symstt) ];
 		*syp = symlev;
+		hcur = NULL;
+		k = symtab[i].x_sy_sg;
+		sec = k < x_hdr.x_nseg ? maps + k + 1 : 0;
 		j = symtab[i].x_sy_fl;
 		switch( j ){
 
-case X_SY_SEG:		k = lookup( seghash, SEGHASH, symtab[i].x_sy_name );
+case X_SY_SEG:		k = lookup( &seghash, symtab[i].x_sy_name );
 			if( k == -1 ) break;
 			*syp = k;
 			continue;
 
-case X_SY_LOC:		hpos = &discard;
-			if( nolocal ) continue;
+case X_SY_LOC:		if( nolocal ) continue;
 			break;
 
-case X_SY_UNX:		k = lookup( symhash, SYMHASH, symtab[i].x_sy_name );
+case X_SY_UNX:		k = lookup( &symhash, symtab[i].x_sy_name );
 			if( k != -1 ){
 				if( symtab[k].x_sy_val < symtab[i].x_sy_val )
 					symtab[k].x_sy_val = symtab[i].x_sy_val;
@@ -533,21 +1054,24 @@ case X_SY_UNX:		k = lookup( symhash, SYMHASH, symtab[i].x_sy_name );
 case X_SY_GLB:		k = symtab[i].x_sy_sg;
 			symtab[i].x_sy_val += segrel[ k ];
 			symtab[i].x_sy_sg = map[ maps + k ];
-			k = lookup( symhash, SYMHASH, symtab[i].x_sy_name );
+			k = lookup( &symhash, symtab[i].x_sy_name );
 			if( k != -1 ){
 				*syp = k;
 				if( symtab[k].x_sy_fl == X_SY_UNX ){
 					udefcnt--;
 					symtab[ k ] = symtab[ i ];
+					gcdef( k, sec );
 				} else {
-					err("multiple def: %-8s in %s",
+					err("multiple def: %-8.8s in %s",
 						symtab[i].x_sy_name, fname );
 				}
 				continue;
 			}
 		}
-		*hpos = symlev;
-		symtab[ symlev++ ] = symtab[ i ];
+		symtab[ symlev ] = symtab[ i ];
+		gcdef( symlev, sec );
+		if( hcur ) hadd( symlev );
+		symlev++;
 	}
 }
 
@@ -557,13 +1081,11 @@ int trysim(void)
 	reg int i, k;
 
 	if( !rdhead() ) return( 0 );
-	i = x_hdr.x_magic;
-	if( seg && i != X_SU_MAGIC && i != X_SX_MAGIC ) return( 0 );
-	if( nonseg && ( i==X_SU_MAGIC || i==X_SX_MAGIC) ) return( 0 );
+	if( !armagic() ) return( 0 );
 	if( !symread() ) return( 0 );
 	for( i=symlev; i < symtop; i++ ){
 		if( symtab[ i ].x_sy_fl == X_SY_GLB ){
-			k = lookup( symhash, SYMHASH, symtab[i].x_sy_name );
+			k = lookup( &symhash, symtab[i].x_sy_name );
 			if( k != -1 && symtab[k].x_sy_fl == X_SY_UNX )
 				return( 1 );
 		}
@@ -584,7 +1106,7 @@ int symread(void)
 		return( 0 );
 	}
 	symtop = symlev + x_hdr.x_symb/sizeof( struct x_sym );
-	if( symtop > SYMNO ) errex("symbol table overflow in %s",fname);
+	symtab = grow( symtab, &nsymtab, symtop, sizeof *symtab );
 	i = x_hdr.x_symb;
 	if( read(infile, &symtab[symlev], i) != i ){
 		err( "bad symbol table read in %s", fname );
@@ -596,6 +1118,219 @@ int symread(void)
 }
 
 
+/*
+ * gcdef - Note for -g that symbol j belongs to section sec-1.
+ */
+void gcdef(int j, int sec)
+{
+	if( !gc ) return;
+	gcsym = grow( gcsym, &ngcsym, j, sizeof *gcsym );
+	gcsym[ j ] = sec;
+}
+
+
+/*
+ * gcmark - Section garbage collection for -g.  Each segment of each
+ * module is a section.  The sections of the first module, where the
+ * load starts, are live, and so is one defining a symbol named with -u,
+ * and any section a live one refers to.  The others are left out here,
+ * before interlude() places anything: the sections after them move
+ * down, and their symbols with them.  The symbols of dead sections go,
+ * and so do undefined symbols that only dead sections wanted.
+ */
+void gcmark(void)
+{
+	reg int i, j, k;
+	int *first, *stack, *newx, nsp, ndead, oldlev;
+	char *used;
+	long cut[SEGNO], bytes;
+	struct x_sym *syp;
+
+	gcsym = grow( gcsym, &ngcsym, symlev, sizeof *gcsym );
+	gcsec = grow( gcsec, &ngcsec, mapx, sizeof *gcsec );
+	k = modno > 1 ? modmap[ 1 ] : mapx;
+	gcread();
+
+	/* the references out of each section, together */
+	qsort( gcedge, gcn, sizeof *gcedge, gccmp );
+	first = calloc( mapx+1, sizeof( int ) );
+	stack = malloc( (mapx+1) * sizeof( int ) );
+	used = calloc( symlev, 1 );
+	newx = calloc( symlev, sizeof( int ) );
+	if( !first || !stack || !used || !newx ) errex( "out of memory" );
+	for( i=0; i < gcn; i++ ) first[ gcedge[i].from + 1 ]++;
+	for( i=0; i < mapx; i++ ) first[ i+1 ] += first[ i ];
+
+	nsp = 0;
+	for( i=0; i < k; i++ ){
+		gcsec[ i ].live = 1;
+		stack[ nsp++ ] = i;
+	}
+	for( i=1; i < gcu && i < symlev; i++ ){
+		used[ i ] = 1;
+		if( (j = gcsym[ i ]-1) >= 0 && !gcsec[ j ].live ){
+			gcsec[ j ].live = 1;
+			stack[ nsp++ ] = j;
+		}
+	}
+	while( nsp > 0 ){
+		k = stack[ --nsp ];
+		for( i = first[ k ]; i < first[ k+1 ]; i++ ){
+			j = gcedge[ i ].to;
+			if( j < 0 )
+				used[ ~j ] = 1;
+			else if( !gcsec[ j ].live ){
+				gcsec[ j ].live = 1;
+				stack[ nsp++ ] = j;
+			}
+		}
+	}
+
+	/* close up the segments */
+	memset( cut, 0, sizeof cut );
+	ndead = 0;
+	bytes = 0;
+	for( i=0; i < mapx; i++ ){
+		j = map[ i ] & 0377;
+		if( j >= SEGNO ) continue;
+		gcsec[ i ].cut = cut[ j ];
+		if( gcsec[ i ].live ) continue;
+		cut[ j ] += gcsec[ i ].len;
+		bytes += gcsec[ i ].len;
+		ndead++;
+	}
+	for( j=0; j<SEGNO; j++ ) segtab[ j ].segsiz -= cut[ j ];
+
+	/* and the symbol table */
+	oldlev = symlev;
+	for( i=k=1; i < oldlev; i++ ){
+		syp = &symtab[ i ];
+		j = gcsym[ i ]-1;
+		if( j >= 0 && !gcsec[ j ].live ) continue;
+		if( syp->x_sy_fl == X_SY_GLB ){
+			if( j >= 0 )
+				syp->x_sy_val -= gcsec[ j ].cut;
+			else if( (syp->x_sy_sg & 0177) != 127 )
+				syp->x_sy_val -= cut[ syp->x_sy_sg & 0177 ];
+		} else if( syp->x_sy_fl == X_SY_UNX && !used[ i ] ){
+			udefcnt--;
+			continue;
+		}
+		newx[ i ] = k;
+		symtab[ k++ ] = *syp;
+	}
+	symlev = k;
+	for( i=0; i < symx; i++ )
+		symap[ i ] = symap[ i ] < oldlev ? newx[ symap[ i ] ] : 0;
+	/* symhash and seghash are stale now, but pass1 is done with them */
+
+	if( debug ) fprintf( stderr, "gc: %d of %d sections, %ld bytes left out\n",
+		ndead, mapx, bytes );
+	free( first );
+	free( stack );
+	free( used );
+	free( newx );
+}
+
+
+/*
+ * gcread - Collect the references between sections from the
+ * relocation items of every module, going through the files the way
+ * pass2 will.
+ */
+void gcread(void)
+{
+	reg int i, n;
+
+	modno = 0;
+	gcn = 0;
+	for( i=0; i < filndx; i++ ){
+		if( filtab[ i ].posndx == 0 ) continue;
+		fname = filtab[ i ].filname;
+		infile = openb( filpath( i ), 0 );
+		if( infile < 0 ) errex( "can't read %s", fname );
+		inopen();
+		if( (n = filtab[ i ].posndx) > 0 ){
+			while( postab[ n ] ){
+				inpos = postab[ n++ ];
+				gcload();
+			}
+		} else {
+			inpos = 0;
+			gcload();
+		}
+		inclose();
+	}
+}
+
+
+/*
+ * gcload - Collect the references out of the sections of the module
+ * at inpos.
+ */
+void gcload(void)
+{
+	reg int i, j;
+	reg struct x_sg *xp;
+	struct x_rel rel;
+	char *cp;
+	long n;
+	int nsym, z;
+
+	if( (cp = inread( XHSIZ )) == NULL )
+		errex( "unexpected EOF while reading header on %s", fname );
+	memcpy( &x_hdr, cp, XHSIZ );
+	swap_hdr( &x_hdr );
+	i = x_hdr.x_nseg * sizeof( struct x_sg );
+	if( (cp = inread( i )) == NULL )
+		errex( "bad seg read in %s", fname );
+	memcpy( x_sg, cp, i );
+	maps = modmap[ modno ];
+	syms = modsym[ modno++ ];
+	nsym = x_hdr.x_symb / sizeof( struct x_sym );
+	for( xp=x_sg, i=0; i < x_hdr.x_nseg; xp++, i++ ) swap_sg( xp );
+	if( (z = segdata( &x_hdr, x_sg )) < 0 )
+		errex( "segment data does not add up in %s", fname );
+	for( xp=x_sg, i=0; i < x_hdr.x_nseg; xp++, i++ )
+		if( indata( xp->x_sg_typ, z ) && inread( xp->x_sg_len ) == NULL )
+			errex( "bad read in %s", fname );
+	n = x_hdr.x_reloc / sizeof( struct x_rel );
+	if( (cp = inread( n * sizeof( struct x_rel ) )) == NULL )
+		errex( "bad relocation read in %s", fname );
+	for( ; n > 0; n--, cp += sizeof( struct x_rel ) ){
+		memcpy( &rel, cp, sizeof rel );
+		swap_rel( &rel );
+		if( rel.x_rl_flg & X_RL_NOTE || rel.x_rl_sgn >= x_hdr.x_nseg )
+			continue;
+		if( rel.x_rl_flg & 04 ){
+			if( rel.x_rl_bas >= nsym ) continue;
+			j = symap[ syms + rel.x_rl_bas ];
+			if( j >= symlev ) continue;
+			if( gcsym[ j ] )
+				gcadd( maps + rel.x_rl_sgn, gcsym[ j ]-1 );
+			else if( symtab[ j ].x_sy_fl == X_SY_UNX )
+				gcadd( maps + rel.x_rl_sgn, ~j );
+		} else if( rel.x_rl_bas < x_hdr.x_nseg )
+			gcadd( maps + rel.x_rl_sgn, maps + rel.x_rl_bas );
+	}
+}
+
+
+void gcadd(int from, int to)
+{
+	if( from == to ) return;
+	gcedge = grow( gcedge, &ngcedge, gcn, sizeof *gcedge );
+	gcedge[ gcn ].from = from;
+	gcedge[ gcn++ ].to = to;
+}
+
+
+int gccmp(const void *a, const void *b)
+{
+	return( ((struct gcedge *)a)->from - ((struct gcedge *)b)->from );
+}
+
+
 void interlude(void)
 {
 	int i, j;
@@ -658,7 +1393,7 @@ void loadmap(void)
 
 	fprintf( stdout, "\nsymbols:\n\n" );
 	for( i=1; i < symlev; i++ )
-		fprintf( stdout, "%3d %-8s  %3d  %d  %4x\n",
+		fprintf( stdout, "%3d %-8.8s  %3d  %d  %4x\n",
 			i,
 			symtab[i].x_sy_name,
 			symtab[i].x_sy_sg & 0377,
@@ -670,9 +1405,12 @@ void loadmap(void)
 void pass2(void)
 {
 	reg int i;
+	struct segtab save[SEGNO];
 
-	modno = 0;
-	for( i=0; i < filndx; i++ ){
+	memcpy( save, segtab, sizeof save );
+	p2modn = p2segn = 0;
+	if( lkrelink ) lkread();
+	else for( i=modno=0; i < filndx; i++ ){
 		fname = filtab[ i ].filname;
 		if( filtab[ i ].posndx ){
 			if( fname[0] == '-' ){
@@ -689,10 +1427,23 @@ void pass2(void)
 				if( infile < 0 )
 					errex( "p2 can't open %s", fname );
 			}
+			inopen();
 			p2read( i );
-			close( infile );
+			inkeep();
 		}
 	}
+	memcpy( segtab, save, sizeof save );
+	if( relax ) p2relax();
+	p2run();
+	for( i=0; i < p2modn; i++ ) p2done( &p2mod[ i ] );
+	if( rlxn ) p2squeeze();
+	while( ninmaps > 0 ){
+		--ninmaps;
+		inmap = inmaps[ ninmaps ].map;
+		insiz = inmaps[ ninmaps ].siz;
+		inmapped = inmaps[ ninmaps ].mapped;
+		inclose();
+	}
 }
 
 
@@ -700,198 +1451,608 @@ void p2read(int n)
 {
 	reg int i;
 
+	p2file = n;
 	i = filtab[ n ].posndx;
 	if( i == 0 ) return;
 	if( i > 0 ){
 		while( postab[ i ] ){
-			lseek( infile, postab[ i++ ], 0 );
+			inpos = postab[ i++ ];
 			p2load();
 		}
 		return;
 	}
+	inpos = 0;
 	p2load();
 }
 
 
+/*
+ * p2load - Place the module at inpos: give each of its segments its
+ * spot in the output, and note where its data and relocation items are
+ * in the mapped input.  Nothing is copied yet; p2apply() does that.
+ */
 void p2load(void)
 {
 	reg int i, j;
 	reg struct x_sg *xp;
 	reg uns l;
-	int k;
-
-	if( !rdhead() )return;
+	reg struct p2seg *sp;
+	struct p2mod *mp;
+	char *cp;
+	int k, z;
+	long start;
+
+	start = inpos;
+	if( (cp = inread( XHSIZ )) == NULL )
+		errex("unexpected EOF while reading header on %s", fname );
+	memcpy( &x_hdr, cp, XHSIZ );
+	swap_hdr( &x_hdr );
 	i = x_hdr.x_nseg * sizeof( struct x_sg );
-	if( read( infile, x_sg, i ) != i )
+	if( (cp = inread( i )) == NULL )
 		errex("bad seg read in p2 %s", fname );
+	memcpy( x_sg, cp, i );
 	/* byte-swap all segment headers */
 	for( k=0; k < x_hdr.x_nseg; k++ ) swap_sg( &x_sg[k] );
-
-	maps = modmap[ modno ];
-	syms = modsym[ modno++ ];
-	for( xp=x_sg, i=0; i < x_hdr.x_nseg; xp++, i++ ){
+	if( (z = segdata( &x_hdr, x_sg )) < 0 )
+		errex("segment data does not add up in %s", fname );
+
+	p2mod = grow( p2mod, &np2mod, p2modn, sizeof *p2mod );
+	p2seg = grow( p2seg, &np2seg, p2segn + x_hdr.x_nseg - 1,
+		sizeof *p2seg );
+	mp = &p2mod[ p2modn++ ];
+	mp->name = fname;
+	mp->maps = maps = modmap[ modno ];
+	mp->syms = syms = modsym[ modno++ ];
+	mp->seg = p2segn;
+	mp->nseg = x_hdr.x_nseg;
+	mp->ovfl = mp->badsg = 0;
+	memset( mp->nrt, 0, sizeof mp->nrt );
+	mp->out = NULL;
+	p2segn += x_hdr.x_nseg;
+	sp = &p2seg[ mp->seg ];
+	for( xp=x_sg, i=0; i < x_hdr.x_nseg; xp++, sp++, i++ ){
 		j = map[ maps + i ];
-		segsiz[ i ] = segtab[ j ].segsiz;
-		segrel[ i ] = segtab[ j ].segrel + segtab[ j ].segsiz;
-		segpos[ i ] = segtab[ j ].segpos;
-		segtab[ j ].segsiz += xp->x_sg_len;
-		round( segtab[ j ].segsiz );
-		if( idata[ xp->x_sg_typ ] ){
+		sp->siz = segtab[ j ].segsiz;
+		sp->rel = segtab[ j ].segrel + segtab[ j ].segsiz;
+		sp->pos = segtab[ j ].segpos;
+		sp->data = NULL;
+		sp->len = 0;
+		sp->dead = gc && !gcsec[ maps + i ].live;
+		if( !sp->dead ){
+			segtab[ j ].segsiz += xp->x_sg_len;
+			round( segtab[ j ].segsiz );
+		}
+		if( indata( xp->x_sg_typ, z ) ){
 			uns inlen;
 
-			lseek( objfile, segpos[ i ], 0 );
 			inlen = xp->x_sg_len;
+			if( (cp = inread( inlen )) == NULL )
+				errex("bad read in %s",fname);
+			if( sp->dead || !idata[ xp->x_sg_typ ] ) continue;
 			l = inlen;
 			round( l );
 			segtab[ j ].segpos += l;
-			bpos = 1;
-			while( inlen ){
-				k = inlen > 512 ? 512 : inlen;
-				if( read( infile, buf , k ) != k)
-					errex("bad read in %s",fname);
-				if( write( objfile, buf, k ) != k)
-					errex("bad write in %s",objname);
-				inlen -= k;
-			}
+			if( sp->pos + inlen > imgsiz )
+				errex("bad write in %s",objname);
+			sp->data = cp;
+			sp->len = inlen;
+		}
+	}
+	mp->nrel = x_hdr.x_reloc / sizeof( struct x_rel );
+	if( (mp->rel = inread( mp->nrel * sizeof( struct x_rel ) )) == NULL )
+		errex("bad relocation read in %s",fname);
+	if( saverel && mp->nrel ){
+		mp->out = malloc( mp->nrel * sizeof( struct x_rel ) );
+		if( mp->out == NULL ) errex( "out of memory for %s", fname );
+	}
+	if( incr && !lkrelink ){
+		lkadv = grow( lkadv, &nlkadv, maps + x_hdr.x_nseg,
+			sizeof *lkadv );
+		for( xp=x_sg, i=0; i < x_hdr.x_nseg; xp++, i++ ){
+			l = xp->x_sg_len;
+			round( l );
+			lkadv[ maps+i ].siz = l;
+			lkadv[ maps+i ].pos = idata[ xp->x_sg_typ ] ? l : 0;
 		}
+		lkmod = grow( lkmod, &nlkmod, p2modn, sizeof *lkmod );
+		lkmod[ p2modn-1 ].file = p2file;
+		lkmod[ p2modn-1 ].fpos = start;
+		if( !lkhash( &lkmod[ p2modn-1 ], start ) )
+			errex("bad read in %s",fname);
 	}
-	p2dorel();
 }
 
 
-void p2dorel(void)
+/*
+ * segdata - Check the segment lengths of a module against x_init, the
+ * length of its data.  A segment of type 0 has no data as far as
+ * idata[] goes, but xcon makes one for each .common and writes its data
+ * all the same.  Returns 1 if the type 0 segments have their data in
+ * the file, 0 if not, and -1 if x_init adds up neither way.
+ */
+int segdata(struct x_hdr *hp, struct x_sg *sg)
 {
-	long l;
 	reg int i;
-	reg struct x_rel *rlp;
-
-	l = x_hdr.x_reloc;
-	while( l ){
-		i = l > RSIZ ? RSIZ : l;
-		if( read( infile, rlibuf, i ) != i )
-			errex("bad relocation read in %s",fname);
-		l -= i;
-		/* byte-swap relocation entries */
-		{
-			int n, cnt = i / sizeof(struct x_rel);
-			for( n=0; n < cnt; n++ ) swap_rel( &rlibuf[n] );
-		}
-		rlp = rlibuf;
-		while( i > 0 ){
-			reloc( rlp );
-			i -= sizeof( struct x_rel );
-			rlp++;
-		}
+	long n, z;
+
+	n = z = 0;
+	for( i=0; i < hp->x_nseg; i++ ){
+		if( sg[i].x_sg_typ >= sizeof idata ) return( -1 );
+		if( idata[ sg[i].x_sg_typ ] ) n += sg[i].x_sg_len;
+		else if( sg[i].x_sg_typ == X_SG_UND ) z += sg[i].x_sg_len;
 	}
-	flshbuf();
+	if( n == hp->x_init ) return( 0 );
+	if( n + z == hp->x_init ) return( 1 );
+	return( -1 );
 }
 
-
-void reloc(struct x_rel *rlp)
+/*
+ * p2run - Apply every placed module to the image, on nthread threads.
+ * Modules write disjoint parts of the image and only read the tables,
+ * so the order they are done in doesn't matter.
+ */
+void p2run(void)
 {
-	reg int j;
-	int s;  /* segment number */
-	uns val;
-	long pos;
-	int off;
-	uint16_t tmp;
+	pthread_t *tid;
+	reg int i, n;
 
-	if( rlp->x_rl_flg & 04 ){  /* external item in symbol table */
-		j = symap[ syms + rlp->x_rl_bas ];
-		s = 127;
-		if( saverel ){
-			val = 0;
-			rlp->x_rl_bas = j-1;
-		} else {
-			val = symtab[ j ].x_sy_val;
-			j = symtab[ j ].x_sy_sg & 0177;
-			if( j != 127 ) s = map[ maps + j ];
-		}
-	} else {
-		j = rlp->x_rl_bas;
-		s = map[ maps + j ];
-		val = segrel[ j ];
-		if( saverel ) rlp->x_rl_bas = s;
-	}
-	pos = segpos[ rlp->x_rl_sgn ] + rlp->x_rl_loc;
-	if( saverel ){
-		rlp->x_rl_loc += segsiz[ rlp->x_rl_sgn ];
-		rlp->x_rl_sgn = map[maps+rlp->x_rl_sgn];
-		putrel( rlp );
+	n = nthread < p2modn ? nthread : p2modn;
+	p2next = 0;
+	if( n <= 1 ){
+		p2work( NULL );
+		return;
 	}
-	off = pos & 511;
-	getbuf( pos );
-	dirty++;
-	switch( rlp->x_rl_flg & 03 ){
+	tid = malloc( (n-1) * sizeof *tid );
+	if( tid == NULL ) errex( "out of memory for threads" );
+	for( i=0; i < n-1; i++ )
+		if( pthread_create( &tid[i], NULL, p2work, NULL ) != 0 )
+			break;
+	p2work( NULL );
+	while( --i >= 0 )
+		pthread_join( tid[i], NULL );
+	free( tid );
+}
 
-case X_RL_OFF:	/* relocate a 16 bit simple offset */
-		tmp = rd16be(&buf[off]);
-		tmp += val;
-		wr16be(&buf[off], tmp);
-		break;
 
-case X_RL_SSG:	/* relocate a short seg plus offset */
-		tmp = rd16be(&buf[off]);
-		val += tmp & 0377;
-		if( val > 255 ) err("short segment offset overflow in %s",fname);
-		wr16be(&buf[off], ( s << 8 ) | val);
-		break;
+void *p2work(void *arg)
+{
+	int i;
 
-case X_RL_LSG:	/* relocate a long seg plus offset */
-		wr16be(&buf[off], 0100000 | (s << 8));
-		pos += 2;
-		getbuf( pos );
-		off = pos & 511;
-		tmp = rd16be(&buf[off]);
-		tmp += val;
-		wr16be(&buf[off], tmp);
-		dirty++;
+	for(;;){
+		pthread_mutex_lock( &p2lock );
+		i = p2next++;
+		pthread_mutex_unlock( &p2lock );
+		if( i >= p2modn ) return( NULL );
+		p2apply( &p2mod[ i ] );
 	}
 }
 
 
-void finale(void)
+/*
+ * p2apply - Copy one module's initialized data into the image and
+ * relocate it.
+ */
+void p2apply(struct p2mod *mp)
 {
-	reg int i, j;
-	struct x_hdr out_hdr;
+	reg int i;
+	reg struct p2seg *sp;
+	struct x_rel rel;
+	long l;
+	char *cp;
+
+	sp = &p2seg[ mp->seg ];
+	for( i=0; i < mp->nseg; i++, sp++ )
+		if( sp->data )
+			memcpy( image + sp->pos, sp->data, sp->len );
+	cp = mp->rel;
+	for( l=0; l < mp->nrel; l++ ){
+		memcpy( &rel, cp, sizeof( struct x_rel ) );
+		cp += sizeof( struct x_rel );
+		swap_rel( &rel );
+		reloc( mp, &rel );
+		if( mp->out ) mp->out[ l ] = rel;
+	}
+}
 
-	x_hdr.x_magic = (udefcnt == 0);
-	x_hdr.x_magic |= nonseg ?
-				(splitid ? X_NUI_MAGIC : X_NU_MAGIC) :
+
+/*
+ * p2done - Report what went wrong in a module and pass its relocation
+ * items on, in module order whatever order the modules were done in.
+ */
+void p2done(struct p2mod *mp)
+{
+	long l;
+
+	for( l=0; l < mp->ovfl; l++ )
+		err("short segment offset overflow in %s",mp->name);
+	if( mp->badsg )
+		err("%d relocation items name no segment of %s",
+			mp->badsg, mp->name);
+	for( l=0; l < 8; l++ ) strt[ l ] += mp->nrt[ l ];
+	if( mp->out ){
+		for( l=0; l < mp->nrel; l++ ) putrel( &mp->out[ l ] );
+		free( mp->out );
+		mp->out = NULL;
+	}
+}
+
+
+/*
+ * p2relax - Branch relaxation for -b.  Every jp cc,address and call
+ * address that xcon marked, whose target is relocatable and ends up in
+ * range, becomes a jr or calr, two bytes shorter.  Taking bytes out
+ * only brings code closer together, so the set of relaxed instructions
+ * just grows until it stops changing.  The rest of the link then works
+ * in the new addresses: the symbols are moved here, reloc() moves
+ * internal references and redoes relative addresses, and p2squeeze()
+ * finally takes the bytes out of the image.
+ */
+void p2relax(void)
+{
+	reg int i, k;
+	reg struct rlx *rp;
+	struct p2mod *mp;
+	struct p2seg *sp;
+	struct x_rel rel, *nxt, key;
+	char *cp;
+	int n, j, nadr;
+	long d;
+	uint16_t op;
+
+	rlxn = 0;
+	for( mp=p2mod; mp < &p2mod[p2modn]; mp++ ){
+		/* the module's 16 bit items, to find the address of each jump */
+		nadr = 0;
+		cp = mp->rel;
+		for( k=0; k < mp->nrel; k++, cp += sizeof( struct x_rel ) ){
+			memcpy( &rel, cp, sizeof rel );
+			swap_rel( &rel );
+			if( rel.x_rl_flg != X_RL_OFF && rel.x_rl_flg != X_RL_XOF )
+				continue;
+			rlxadr = grow( rlxadr, &nrlxadr, nadr, sizeof *rlxadr );
+			rlxadr[ nadr++ ] = rel;
+		}
+		qsort( rlxadr, nadr, sizeof *rlxadr, relcmp );
+
+		cp = mp->rel;
+		for( k=0; k < mp->nrel; k++, cp += sizeof( struct x_rel ) ){
+			memcpy( &rel, cp, sizeof rel );
+			swap_rel( &rel );
+			if( rel.x_rl_flg != X_RL_NOTE || rel.x_rl_bas != X_NT_JMP ||
+					rel.x_rl_sgn >= mp->nseg )
+				continue;
+			sp = &p2seg[ mp->seg + rel.x_rl_sgn ];
+			if( sp->data == NULL || rel.x_rl_loc + 4 > sp->len )
+				continue;
+			op = rd16be( sp->data + rel.x_rl_loc );
+			if( (op & 0xfff0) != 0x5e00 && op != 0x5f00 ) continue;
+
+			/* a jump to an absolute address stays as it is */
+			key.x_rl_sgn = rel.x_rl_sgn;
+			key.x_rl_loc = rel.x_rl_loc + 2;
+			nxt = nadr ? bsearch( &key, rlxadr, nadr, sizeof *rlxadr,
+				relcmp ) : NULL;
+			if( nxt == NULL ) continue;
+			d = rd16be( sp->data + rel.x_rl_loc + 2 );
+			if( nxt->x_rl_flg == X_RL_OFF ){
+				if( nxt->x_rl_bas >= mp->nseg ) continue;
+				d += p2seg[ mp->seg + nxt->x_rl_bas ].rel;
+			} else {
+				j = symap[ mp->syms + nxt->x_rl_bas ];
+				if( (symtab[j].x_sy_sg & 0177) == 127 ) continue;
+				d += symtab[j].x_sy_val;
+			}
+			if( d & 1 ) continue;
+
+			rlx = grow( rlx, &nrlx, rlxn, sizeof *rlx );
+			rp = &rlx[ rlxn++ ];
+			rp->a = sp->rel + rel.x_rl_loc;
+			rp->pos = sp->pos + rel.x_rl_loc;
+			rp->t = d;
+			rp->op = op;
+			rp->seg = map[ mp->maps + rel.x_rl_sgn ];
+			rp->on = 0;
+		}
+	}
+	qsort( rlx, rlxn, sizeof *rlx, rlxcmp );
+	rlxcnt = grow( rlxcnt, &nrlxcnt, rlxn, sizeof *rlxcnt );
+
+	do {
+		n = 0;
+		for( rp=rlx; rp < &rlx[rlxn]; rp++ ){
+			if( rp->on ) continue;
+			d = rlxmove( rp->t ) - rlxmove( rp->a ) - 2;
+			if( (rp->op & 0xff00) == 0x5e00 ?
+					d >= -256 && d <= 254 :
+					d >= -4094 && d <= 4096 ){
+				rp->on = 1;
+				n++;
+			}
+		}
+		for( i=0; i < rlxn; i++ )
+			rlxcnt[i+1] = rlxcnt[i] + rlx[i].on;
+	} while( n );
+
+	/* from here on only the relaxed ones matter */
+	for( i=n=0; i < rlxn; i++ )
+		if( rlx[i].on ) rlx[ n++ ] = rlx[i];
+	rlxn = n;
+	for( i=0; i <= rlxn; i++ ) rlxcnt[i] = i;
+	if( rlxn == 0 ) return;
+	for( i=1; i<symlev; i++ )
+		if( symtab[i].x_sy_fl & (X_SY_GLB & X_SY_LOC) &&
+				(symtab[i].x_sy_sg & 0177) != 127 )
+			symtab[i].x_sy_val = rlxmove( symtab[i].x_sy_val );
+}
+
+
+int relcmp(const void *a, const void *b)
+{
+	const struct x_rel *p = a, *q = b;
+
+	if( p->x_rl_sgn != q->x_rl_sgn ) return( p->x_rl_sgn - q->x_rl_sgn );
+	return( (int)p->x_rl_loc - (int)q->x_rl_loc );
+}
+
+
+int rlxcmp(const void *a, const void *b)
+{
+	long d;
+
+	d = ((struct rlx *)a)->a - ((struct rlx *)b)->a;
+	return( d < 0 ? -1 : d > 0 );
+}
+
+
+/*
+ * rlxmove - Where old address x ends up with the current set of
+ * relaxed instructions: each one before it takes out two bytes.
+ */
+long rlxmove(long x)
+{
+	reg int lo, hi, m;
+
+	lo = 0;
+	hi = rlxn;
+	while( lo < hi ){
+		m = (lo + hi) / 2;
+		if( rlx[m].a + 2 < x ) lo = m+1;
+		else hi = m;
+	}
+	return( x - 2 * rlxcnt[lo] );
+}
+
+
+/*
+ * renote - Redo the instruction at old address a, at p in the image,
+ * for the relaxed layout.
+ */
+void renote(long a, char *p, int kind)
+{
+	reg int lo, hi, m;
+	long t, d;
+	uint16_t op;
+
+	op = rd16be( p );
+	switch( kind ){
+
+case X_NT_JMP:	/* jp cc,address or call address */
+		lo = 0;
+		hi = rlxn;
+		while( lo < hi ){
+			m = (lo + hi) / 2;
+			if( rlx[m].a < a ) lo = m+1;
+			else hi = m;
+		}
+		if( lo == rlxn || rlx[lo].a != a ) return;
+		d = rlxmove( rlx[lo].t ) - rlxmove( a ) - 2;
+		if( (op & 0xff00) == 0x5e00 )
+			wr16be( p, 0xe000 | (op & 0xf) << 8 | (d/2 & 0xff) );
+		else
+			wr16be( p, 0xd000 | (-d/2 & 0xfff) );
+		break;
+
+case X_NT_R7:	/* djnz: backwards only */
+		t = a + 2 - 2 * (op & 0x7f);
+		d = rlxmove( a ) + 2 - rlxmove( t );
+		wr16be( p, (op & ~0x7f) | (d/2 & 0x7f) );
+		break;
+
+case X_NT_R8:	/* jr */
+		t = a + 2 + 2 * (signed char)(op & 0xff);
+		d = rlxmove( t ) - rlxmove( a ) - 2;
+		wr16be( p, (op & 0xff00) | (d/2 & 0xff) );
+		break;
+
+case X_NT_R12:	/* calr */
+		d = op & 0xfff;
+		if( d & 0x800 ) d -= 0x1000;
+		t = a + 2 - 2 * d;
+		d = rlxmove( a ) + 2 - rlxmove( t );
+		wr16be( p, (op & 0xf000) | (d/2 & 0xfff) );
+		break;
+
+case X_NT_R16:	/* ldr, ldar: the displacement follows */
+		if( p + 4 > image + imgsiz ) break;
+		t = a + 4 + (int16_t)rd16be( p+2 );
+		d = rlxmove( t ) - rlxmove( a ) - 4;
+		wr16be( p+2, d );
+		break;
+	}
+}
+
+
+/*
+ * p2squeeze - Take the addresses of the relaxed instructions out of
+ * the image, and shorten the segments they were in.
+ */
+void p2squeeze(void)
+{
+	reg int i, j, n;
+	long src, dst, end;
+
+	/* each segment moves down by two for every one before its start */
+	for( j=0; j<SEGNO; j++ ){
+		if( !segtab[j].hiwat ) continue;
+		for( i=n=0; i < rlxn; i++ )
+			if( rlx[i].pos < segtab[j].segpos ) n++;
+		segtab[j].segpos -= 2 * n;
+	}
+	for( i=0; i < rlxn; i++ )
+		segtab[ rlx[i].seg ].hiwat -= 2;
+
+	dst = rlx[0].pos + 2;
+	for( i=0; i < rlxn; i++ ){
+		src = rlx[i].pos + 4;
+		end = i+1 < rlxn ? rlx[i+1].pos + 2 : imgsiz;
+		memmove( image + dst, image + src, end - src );
+		dst += end - src;
+	}
+	imgsiz = dst;
+	relpos -= 2 * rlxn;
+}
+
+
+/*
+ * reloc - Apply one relocation item of module mp to the output image.
+ * Items that fall outside the initialized part of the image (for
+ * instance against a bss segment) have nothing to patch.
+ */
+void reloc(struct p2mod *mp, struct x_rel *rlp)
+{
+	reg int j;
+	int s;  /* segment number */
+	uns val;
+	long pos;
+	char *p;
+	uint16_t tmp;
+	struct p2seg *sp;
+
+	sp = &p2seg[ mp->seg ];
+	if( rlp->x_rl_sgn < mp->nseg && sp[ rlp->x_rl_sgn ].dead ) return;
+	mp->nrt[ rlp->x_rl_flg & X_RL_NOTE ? 0 : rlp->x_rl_flg & 07 ]++;
+	if( rlp->x_rl_flg & X_RL_NOTE ){  /* nothing to relocate */
+		if( rlp->x_rl_sgn >= mp->nseg ){
+			mp->badsg++;
+			return;
+		}
+		pos = sp[ rlp->x_rl_sgn ].pos + rlp->x_rl_loc;
+		if( saverel ){
+			rlp->x_rl_loc += sp[ rlp->x_rl_sgn ].siz;
+			rlp->x_rl_sgn = map[ mp->maps + rlp->x_rl_sgn ];
+		} else if( rlxn && pos >= 0 && pos + 2 <= imgsiz )
+			renote( sp[ rlp->x_rl_sgn ].rel + rlp->x_rl_loc,
+				image + pos, rlp->x_rl_bas );
+		return;
+	}
+	if( rlp->x_rl_flg & 04 ){  /* external item in symbol table */
+		j = symap[ mp->syms + rlp->x_rl_bas ];
+		s = 127;
+		if( saverel ){
+			val = 0;
+			rlp->x_rl_bas = j-1;
+		} else {
+			val = symtab[ j ].x_sy_val;
+			j = symtab[ j ].x_sy_sg & 0177;
+			if( j != 127 ) s = map[ mp->maps + j ];
+		}
+	} else {
+		j = rlp->x_rl_bas;
+		s = map[ mp->maps + j ];
+		val = j < mp->nseg ? sp[ j ].rel : 0;
+		if( saverel ) rlp->x_rl_bas = s;
+	}
+	if( rlp->x_rl_sgn >= mp->nseg ){
+		mp->badsg++;
+		return;
+	}
+	pos = sp[ rlp->x_rl_sgn ].pos + rlp->x_rl_loc;
+	if( saverel ){
+		rlp->x_rl_loc += sp[ rlp->x_rl_sgn ].siz;
+		rlp->x_rl_sgn = map[ mp->maps + rlp->x_rl_sgn ];
+	}
+	if( pos < 0 || pos + 2 > imgsiz ) return;
+	p = image + pos;
+	switch( rlp->x_rl_flg & 03 ){
+
+case X_RL_OFF:	/* relocate a 16 bit simple offset */
+		tmp = rd16be(p);
+		tmp += val;
+		if( rlxn && !(rlp->x_rl_flg & 04) ) tmp = rlxmove( tmp );
+		wr16be(p, tmp);
+		break;
+
+case X_RL_SSG:	/* relocate a short seg plus offset */
+		tmp = rd16be(p);
+		val += tmp & 0377;
+		if( val > 255 ) mp->ovfl++;
+		wr16be(p, ( s << 8 ) | val);
+		break;
+
+case X_RL_LSG:	/* relocate a long seg plus offset */
+		wr16be(p, 0100000 | (s << 8));
+		if( pos + 4 > imgsiz ) return;
+		tmp = rd16be(p+2);
+		tmp += val;
+		wr16be(p+2, tmp);
+	}
+}
+
+
+void finale(void)
+{
+	reg int i, j;
+	struct x_hdr out_hdr;
+
+	x_hdr.x_magic = (udefcnt == 0);
+	x_hdr.x_magic |= nonseg ?
+				(splitid ? X_NUI_MAGIC : X_NU_MAGIC) :
 				X_SU_MAGIC;
 	x_hdr.x_nseg = objnseg;
 	x_hdr.x_init = relpos - XHSIZ - objnseg * sizeof( struct x_sg );
-	x_hdr.x_reloc = 0;
+	x_hdr.x_reloc = relcnt * sizeof( struct x_rel );
 	x_hdr.x_symb = strip && !saverel ? 0 : (symlev-1)*sizeof(struct x_sym);
 
 	if(debug)segdmp( "finale" );
+	if( outfmt == OF_BIN || outfmt == OF_IHEX ){
+		finimg();
+		return;
+	}
 
-	/* write the segment descriptors */
-	lseek( objfile, (long)XHSIZ, 0 );
+	/* fill in the segment descriptors */
+	sgp = image + XHSIZ;
 	for( j=0; j<prex; j++ ) finout( prelist[j] );
 	for( i=0; i<SEGNO; i++ ) finout( i );
 
+	/* the header, in big-endian; then the image goes out in one piece */
+	out_hdr = x_hdr;
+	swap_hdr( &out_hdr );
+	memcpy( image, &out_hdr, XHSIZ );
+	if( write( objfile, image, imgsiz ) != imgsiz )
+		errex( "bad write in %s", objname );
+
 	/* write the relocation data */
-	lseek( objfile, relpos, 0 );
 	if( saverel ){
-		wrrel();
-		lseek( relfile, 0L, 0 );
-		while( (i = read( relfile, rlibuf, RSIZ )) > 0 ){
-			x_hdr.x_reloc += i;
-			write( objfile, rlibuf, i );
+		if( relfile >= 0 ){
+			wrrel();
+			lseek( relfile, 0L, 0 );
+			while( (i = read( relfile, rlibuf, RSIZ )) > 0 )
+				write( objfile, rlibuf, i );
+			close( relfile );
+		} else {
+			for( i=0; i<rlo; i++ ) swap_rel( &rlobuf[i] );
+			if( write( objfile, rlobuf, rlo * sizeof( struct x_rel ) )
+					!= rlo * sizeof( struct x_rel ) )
+				errex( "bad write in %s", objname );
 		}
 	}
 
 	/* write the symbol table (swap to big-endian) */
 	for( i=1; i<symlev; i++ ) swap_sym( &symtab[i] );
 	write( objfile, &symtab[1], (int)x_hdr.x_symb );
-
-	/* write the header last (swap to big-endian) */
-	out_hdr = x_hdr;
-	swap_hdr( &out_hdr );
-	lseek( objfile, 0L, 0 );
-	write( objfile, &out_hdr, XHSIZ );
 	close( objfile );
+	if( incr || statf )	/* lksave() and stats() want them back */
+		for( i=1; i<symlev; i++ ) swap_sym( &symtab[i] );
 }
 
 
@@ -904,12 +2065,536 @@ void finout(int i)
 		tmp.x_sg_typ = segtab[i].segtyp;
 		tmp.x_sg_len = segtab[i].hiwat;
 		swap_sg( &tmp );
-		write( objfile, &tmp, sizeof( struct x_sg ));
+		memcpy( sgp, &tmp, sizeof( struct x_sg ));
+		sgp += sizeof( struct x_sg );
 		segtab[i].hiwat = 0;
 	}
 }
 
 
+/*
+ * finimg - Write objname as a bare memory image for -F bin or -F ihex.
+ * The segments go in the order x.out has them.  A binary has their
+ * contents one after the other, bss as zeros; a HEX file has the
+ * initialized ones at their load addresses.  Segmented, the segment
+ * number goes in the upper half of the address; split I and D, data
+ * is put in the second 64K.
+ */
+void finimg(void)
+{
+	reg int i, j, t;
+	reg struct segtab *sp;
+	char done[SEGNO], *p;
+	FILE *fp;
+	uns a, hi, up, n;
+	long l;
+
+	if( (fp = fdopen( objfile, "wb" )) == NULL )
+		errex( "can't write %s", objname );
+	memset( done, 0, sizeof done );
+	hi = 0;
+	for( j=0; j < prex + SEGNO; j++ ){
+		i = j < prex ? prelist[j] : j - prex;
+		sp = &segtab[i];
+		t = sp->segtyp;
+		if( done[i] || !sp->hiwat ) continue;
+		done[i] = 1;
+		p = image + sp->segpos;
+		if( outfmt == OF_BIN ){
+			if( idata[t] )
+				fwrite( p, 1, sp->hiwat, fp );
+			else if( t == X_SG_BSS )
+				for( l=0; l < sp->hiwat; l++ ) putc( 0, fp );
+			continue;
+		}
+		if( !idata[t] ) continue;
+		up = !nonseg ? i : splitid && t != X_SG_COD;
+		if( up != hi ){
+			char ext[2];
+
+			wr16be( ext, up );
+			hexrec( fp, 2, 0, 4, ext );
+			hi = up;
+		}
+		a = staddr( sp );
+		for( l=0; l < sp->hiwat; l += n ){
+			n = sp->hiwat - l < 16 ? sp->hiwat - l : 16;
+			hexrec( fp, n, a + l, 0, p + l );
+		}
+	}
+	if( outfmt == OF_IHEX ) hexrec( fp, 0, 0, 1, NULL );
+	if( fflush( fp ) != 0 ) errex( "bad write in %s", objname );
+	fclose( fp );
+}
+
+
+/* hexrec - Put out an Intel HEX record of n bytes at p. */
+void hexrec(FILE *fp, int n, uns a, int typ, char *p)
+{
+	reg int i, sum;
+
+	fprintf( fp, ":%02X%04X%02X", n, a & 0xffff, typ );
+	sum = n + (a >> 8) + a + typ;
+	for( i=0; i < n; i++ ){
+		fprintf( fp, "%02X", p[i] & 0377 );
+		sum += p[i] & 0377;
+	}
+	fprintf( fp, "%02X\n", -sum & 0377 );
+}
+
+
+/* ofmt - The output format named by -F. */
+int ofmt(char *s)
+{
+	if( s == NULL ) errex( "-F wants a format" );
+	if( strcmp( s, "xout" ) == 0 ) return( OF_XOUT );
+	if( strcmp( s, "bin" ) == 0 ) return( OF_BIN );
+	if( strcmp( s, "ihex" ) == 0 ) return( OF_IHEX );
+	if( strcmp( s, "cmd" ) == 0 ) return( OF_CMD );
+	err( "bad output format: %s", s );
+	return( OF_XOUT );
+}
+
+
+/*
+ * Statistics for --stats=json, on stdout once the output is written.
+ * Nothing else may go there, so -m is refused along with it.
+ */
+double stclock(void)
+{
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return( ts.tv_sec + ts.tv_nsec / 1e9 );
+}
+
+
+/* stmark - Charge the time since the last mark to phase i. */
+void stmark(int i)
+{
+	double t;
+
+	t = stclock();
+	sttime[ i ] += t - stlast;
+	stlast = t;
+}
+
+
+/*
+ * stats - Write the statistics, with the segment table sp as it was
+ * after pass2.  The size of a global symbol is the distance to the
+ * next higher global in its segment, or to the end of the segment.
+ * Local symbols are left out: their values are not relocated.
+ */
+void stats(struct segtab *sp, int relinked)
+{
+	static char *rtname[8] = { "note", "off", "ssg", "lsg",
+		"", "xof", "xssg", "xlsg" };
+	reg int i, j;
+	int n;
+	long a, end;
+
+	printf( "{\n  \"output\": \"" );
+	jsname( objname, strlen( objname ) );
+	printf( "\",\n  \"relinked\": %s,\n  \"time\": {",
+		relinked ? "true" : "false" );
+	for( i=0; i < ST_NPH; i++ )
+		printf( "%s\"%s\": %.6f", i ? ", " : " ", stname[i], sttime[i] );
+	printf( " },\n  \"archive\": { \"passes\": %ld, \"probed\": %ld, "
+		"\"loaded\": %ld },\n", arpass, arprobe, arload );
+	printf( "  \"relocations\": {" );
+	for( i=n=0; i < 8; i++ )
+		if( *rtname[i] )
+			printf( "%s\"%s\": %ld", n++ ? ", " : " ",
+				rtname[i], strt[i] );
+	printf( " },\n  \"segments\": [" );
+	for( i=n=0; i < SEGNO; i++ )
+		if( sp[i].hiwat )
+			printf( "%s\n    { \"seg\": %d, \"type\": %d, "
+				"\"size\": %u, \"addr\": %ld }",
+				n++ ? "," : "", i, sp[i].segtyp, sp[i].hiwat,
+				staddr( &sp[i] ) );
+	printf( "%s],\n  \"symbols\": [", n ? "\n  " : "" );
+
+	n = 0;
+	for( i=1; i < symlev; i++ ){
+		j = symtab[i].x_sy_sg & 0377;
+		if( symtab[i].x_sy_fl != X_SY_GLB || j >= SEGNO || !sp[j].hiwat )
+			continue;
+		stsym = grow( stsym, &nstsym, n, sizeof *stsym );
+		stsym[ n++ ] = i;
+	}
+	qsort( stsym, n, sizeof *stsym, stcmp );
+	for( i=0; i < n; i++ ){
+		reg struct x_sym *yp = &symtab[ stsym[i] ];
+
+		a = yp->x_sy_val;
+		end = staddr( &sp[ yp->x_sy_sg ] ) + sp[ yp->x_sy_sg ].hiwat;
+		for( j=i+1; j < n; j++ ){
+			if( symtab[ stsym[j] ].x_sy_sg != yp->x_sy_sg ) break;
+			if( symtab[ stsym[j] ].x_sy_val != a ){
+				end = symtab[ stsym[j] ].x_sy_val;
+				break;
+			}
+		}
+		printf( "%s\n    { \"name\": \"", i ? "," : "" );
+		jsname( yp->x_sy_name, XNAMELN );
+		printf( "\", \"seg\": %d, \"addr\": %ld, \"size\": %ld }",
+			yp->x_sy_sg, a, end > a ? end - a : 0L );
+	}
+	printf( "%s]\n}\n", n ? "\n  " : "" );
+}
+
+
+int stcmp(const void *a, const void *b)
+{
+	reg struct x_sym *p = &symtab[ *(int *)a ], *q = &symtab[ *(int *)b ];
+
+	if( p->x_sy_sg != q->x_sy_sg ) return( p->x_sy_sg - q->x_sy_sg );
+	if( p->x_sy_val != q->x_sy_val )
+		return( (int)p->x_sy_val - (int)q->x_sy_val );
+	return( *(int *)a - *(int *)b );
+}
+
+
+/*
+ * staddr - Where segment sp starts in the addresses the symbols have;
+ * interpos() leaves segrel 0 unless they run on from segment to segment.
+ */
+long staddr(struct segtab *sp)
+{
+	return( rlxn ? rlxmove( sp->segrel ) : sp->segrel );
+}
+
+
+/* jsname - Put out at most n characters of s as a JSON string. */
+void jsname(char *s, int n)
+{
+	reg int i, c;
+
+	for( i=0; i < n && (c = s[i] & 0377) != 0; i++ ){
+		if( c == '"' || c == '\\' ) printf( "\\%c", c );
+		else if( c < ' ' || c >= 0177 ) printf( "\\u%04x", c );
+		else putchar( c );
+	}
+}
+
+
+/*
+ * Incremental relinking.  With -k the results of pass1 are kept in
+ * objname.lks, together with a hash of every module loaded.  The next
+ * -k link of the same files with the same flags reads them back instead
+ * of running pass1, and redoes only the modules whose code or data
+ * changed, in place in the old output.  A module whose header, segment
+ * sizes or symbols changed, or any change to an archive, means the
+ * layout may have moved, and the link is done over in full.
+ */
+
+/*
+ * cfgsum - Hash of everything pass0 decided: the flags, the files and
+ * what -d and -u put into the tables.
+ */
+uint64_t cfgsum(void)
+{
+	reg int i;
+	uint64_t h;
+	long flags[8];
+
+	flags[0] = splitid;
+	flags[1] = shared;
+	flags[2] = strip;
+	flags[3] = nolocal;
+	flags[4] = stacksiz;
+	flags[5] = udefcnt;
+	flags[6] = prex;
+	flags[7] = filndx;
+	h = hashmem( FNVINIT, (char *)flags, sizeof flags );
+	h = hashmem( h, objname, strlen( objname ) + 1 );
+	for( i=0; i < filndx; i++ )
+		h = hashmem( h, filtab[i].filname, strlen( filtab[i].filname ) + 1 );
+	h = hashmem( h, prelist, prex );
+	h = hashmem( h, (char *)segtab, sizeof segtab );
+	return( hashmem( h, (char *)&symtab[1], (symlev-1) * sizeof *symtab ) );
+}
+
+
+/*
+ * lkhash - Hash the module at start in the mapped input: its layout
+ * (header, segment table and symbols) and its contents (initialized
+ * data and relocation items) separately.  Returns 0 if it is cut short.
+ */
+int lkhash(struct lkmod *lp, long start)
+{
+	reg int i;
+	struct x_hdr h;
+	long p, d;
+	int z;
+
+	if( start < 0 || start + XHSIZ > insiz ) return( 0 );
+	memcpy( &h, inmap + start, XHSIZ );
+	swap_hdr( &h );
+	p = start + XHSIZ + h.x_nseg * sizeof( struct x_sg );
+	if( h.x_nseg < 0 || h.x_nseg > MSEGNO || p > insiz ) return( 0 );
+	memcpy( x_sg, inmap + start + XHSIZ, p - start - XHSIZ );
+	for( i=0; i < h.x_nseg; i++ ) swap_sg( &x_sg[i] );
+	if( (z = segdata( &h, x_sg )) < 0 ) return( 0 );
+	d = p;
+	for( i=0; i < h.x_nseg; i++ )
+		if( indata( x_sg[i].x_sg_typ, z ) ) d += x_sg[i].x_sg_len;
+	d += h.x_reloc / sizeof( struct x_rel ) * sizeof( struct x_rel );
+	if( d + h.x_symb > insiz ) return( 0 );
+	h.x_reloc = 0;
+	lp->lay = hashmem( FNVINIT, (char *)&h, XHSIZ );
+	lp->lay = hashmem( lp->lay, inmap + start + XHSIZ, p - start - XHSIZ );
+	lp->lay = hashmem( lp->lay, inmap + d, h.x_symb );
+	lp->dat = hashmem( FNVINIT, inmap + p, d - p );
+	return( 1 );
+}
+
+
+/*
+ * relink - Try to bring objname up to date from objname.lks.  Returns 0,
+ * with nothing changed, when it has to be linked in full instead.
+ */
+int relink(void)
+{
+	FILE *fp;
+	struct lkhdr h;
+	struct lkmod t;
+	struct stat st;
+	reg int i, k;
+	int n;
+
+	if( (fp = fopen( lksname, "rb" )) == NULL ) return( 0 );
+	if( !lkget( fp, &h, sizeof h ) || h.magic != LKSMAGIC ||
+			h.sum != lksum || h.filndx != filndx )
+		goto full;
+	if( stat( objname, &st ) < 0 || !lksame( &st, &h.out ) )
+		goto full;
+	lkfile = grow( lkfile, &nlkfile, filndx, sizeof *lkfile );
+	lkmod = grow( lkmod, &nlkmod, h.modno, sizeof *lkmod );
+	if( !lkget( fp, lkfile, filndx * sizeof *lkfile ) ||
+			!lkget( fp, lkmod, h.modno * sizeof *lkmod ) )
+		goto full;
+
+	/* see what changed; a file holding a single module may have new code */
+	n = 0;
+	for( i=k=0; i < filndx; i++ ){
+		while( k < h.modno && lkmod[k].file < i ) k++;
+		if( stat( filpath( i ), &st ) < 0 ) goto full;
+		if( lksame( &st, &lkfile[i].stamp ) ) continue;
+		if( lkfile[i].posndx >= 0 || k >= h.modno || lkmod[k].file != i )
+			goto full;
+		fname = filtab[i].filname;
+		if( (infile = openb( filpath( i ), 0 )) < 0 ) goto full;
+		inopen();
+		if( !lkhash( &t, lkmod[k].fpos ) || t.lay != lkmod[k].lay ){
+			inclose();
+			goto full;
+		}
+		inclose();
+		if( t.dat != lkmod[k].dat ){
+			lkmod[k].dat = t.dat;
+			lkmod[k].dirty = 1;
+			n++;
+		}
+	}
+
+	/* the layout stands: take back the tables pass1 left */
+	for( i=0; i < filndx; i++ ) filtab[i].posndx = lkfile[i].posndx;
+	posmax = h.posmax;
+	postab = grow( postab, &npostab, posmax+1, sizeof *postab );
+	mapx = h.mapx;
+	mapgrow( mapx );
+	lkadv = grow( lkadv, &nlkadv, mapx, sizeof *lkadv );
+	symx = h.symx;
+	symap = grow( symap, &nsymap, symx, sizeof *symap );
+	modno = h.modno;
+	modmap = grow( modmap, &nmodmap, modno, sizeof *modmap );
+	modsym = grow( modsym, &nmodsym, modno, sizeof *modsym );
+	symlev = h.symlev;
+	symtab = grow( symtab, &nsymtab, symlev, sizeof *symtab );
+	if( !lkget( fp, &postab[1], posmax * sizeof *postab ) ||
+			!lkget( fp, map, mapx ) ||
+			!lkget( fp, symap, symx * sizeof *symap ) ||
+			!lkget( fp, modmap, modno * sizeof *modmap ) ||
+			!lkget( fp, modsym, modno * sizeof *modsym ) ||
+			!lkget( fp, &symtab[1], (symlev-1) * sizeof *symtab ) ||
+			!lkget( fp, lkseg, sizeof lkseg ) ||
+			!lkget( fp, lkadv, mapx * sizeof *lkadv ) )
+		errex( "bad read in %s", lksname );
+	fclose( fp );
+	memcpy( segtab, lkseg, sizeof segtab );
+	imgsiz = h.imgsiz;
+	if( mapf ) loadmap();
+
+	/* redo the changed modules in the old image */
+	if( n ){
+		if( (objfile = openb( objname, 2 )) < 0 )
+			errex( "can't open %s", objname );
+		image = mmap( NULL, imgsiz, PROT_READ|PROT_WRITE, MAP_SHARED,
+			objfile, 0 );
+		if( image == MAP_FAILED ) errex( "can't map %s", objname );
+		lkrelink = 1;
+		pass2();
+		munmap( image, imgsiz );
+		if( errcnt ){
+			unlink( lksname );
+			close( creatb( objname , 0666 ) );
+			errex( "pass2" );
+		}
+		close( objfile );
+	}
+	if( debug ) fprintf( stderr, "relinked %d of %d modules\n", n, modno );
+	lksave();
+	return( 1 );
+
+full:
+	fclose( fp );
+	return( 0 );
+}
+
+
+/*
+ * lkread - pass2's reading for a relink: load the modules relink() found
+ * changed, and move segtab past the others by what they added to it in
+ * the last link, without opening their files.
+ */
+void lkread(void)
+{
+	reg int i, j, k;
+	int n, end;
+
+	n = modno;
+	for( k=0; k < n; k++ ){
+		if( !lkmod[ k ].dirty ){
+			end = k+1 < n ? modmap[ k+1 ] : mapx;
+			for( i=modmap[ k ]; i < end; i++ ){
+				j = map[ i ];
+				segtab[ j ].segsiz += lkadv[ i ].siz;
+				segtab[ j ].segpos += lkadv[ i ].pos;
+			}
+			continue;
+		}
+		p2file = lkmod[ k ].file;
+		fname = filtab[ p2file ].filname;
+		if( (infile = openb( filpath( p2file ), 0 )) < 0 )
+			errex( "p2 can't open %s", fname );
+		inopen();
+		modno = k;
+		inpos = lkmod[ k ].fpos;
+		p2load();
+		inkeep();
+	}
+	modno = n;
+}
+
+
+/*
+ * lksave - Write objname.lks for the link just done.  If that fails the
+ * next link is simply a full one.
+ */
+void lksave(void)
+{
+	FILE *fp;
+	struct lkhdr h;
+	struct stat st;
+	reg int i;
+	int ok;
+
+	memset( &h, 0, sizeof h );
+	h.magic = LKSMAGIC;
+	h.sum = lksum;
+	h.imgsiz = imgsiz;
+	h.filndx = filndx;
+	h.posmax = posmax;
+	h.symlev = symlev;
+	h.mapx = mapx;
+	h.symx = symx;
+	h.modno = modno;
+	lkfile = grow( lkfile, &nlkfile, filndx, sizeof *lkfile );
+	for( i=0; i < filndx; i++ ){
+		lkfile[i].posndx = filtab[i].posndx;
+		if( stat( filpath( i ), &st ) < 0 ) memset( &st, 0, sizeof st );
+		lkstamp( &st, &lkfile[i].stamp );
+	}
+	for( i=0; i < modno; i++ ) lkmod[i].dirty = 0;
+	if( stat( objname, &st ) < 0 || (fp = fopen( lksname, "wb" )) == NULL ){
+		unlink( lksname );
+		return;
+	}
+	lkstamp( &st, &h.out );
+	ok = lkput( fp, &h, sizeof h ) &&
+		lkput( fp, lkfile, filndx * sizeof *lkfile ) &&
+		lkput( fp, lkmod, modno * sizeof *lkmod ) &&
+		lkput( fp, &postab[1], posmax * sizeof *postab ) &&
+		lkput( fp, map, mapx ) &&
+		lkput( fp, symap, symx * sizeof *symap ) &&
+		lkput( fp, modmap, modno * sizeof *modmap ) &&
+		lkput( fp, modsym, modno * sizeof *modsym ) &&
+		lkput( fp, &symtab[1], (symlev-1) * sizeof *symtab ) &&
+		lkput( fp, lkseg, sizeof lkseg ) &&
+		lkput( fp, lkadv, mapx * sizeof *lkadv );
+	if( fclose( fp ) != 0 || !ok ) unlink( lksname );
+}
+
+
+int lkget(FILE *fp, void *p, long n)
+{
+	return( n == 0 || fread( p, n, 1, fp ) == 1 );
+}
+
+
+int lkput(FILE *fp, void *p, long n)
+{
+	return( n == 0 || fwrite( p, n, 1, fp ) == 1 );
+}
+
+
+void lkstamp(struct stat *st, struct lkstamp *sp)
+{
+	sp->size = st->st_size;
+	sp->sec = st->st_mtim.tv_sec;
+	sp->nsec = st->st_mtim.tv_nsec;
+}
+
+
+int lksame(struct stat *st, struct lkstamp *sp)
+{
+	struct lkstamp t;
+
+	lkstamp( st, &t );
+	return( t.size == sp->size && t.sec == sp->sec && t.nsec == sp->nsec );
+}
+
+
+/*
+ * filpath - The name to open file i by: -lx means libx.a.
+ */
+char *filpath(int i)
+{
+	char *s;
+
+	s = filtab[ i ].filname;
+	if( s[0] != '-' ) return( s );
+	ap = libname;
+	append( "lib" );
+	append( s+2 );
+	append( ".a" );
+	return( libname );
+}
+
+
+uint64_t hashmem(uint64_t h, char *p, long n)
+{
+	while( --n >= 0 ){
+		h ^= (unsigned char)*p++;
+		h *= 0x100000001b3ULL;
+	}
+	return( h );
+}
+
+
 void dodline(char *s)
 {
 	reg char *cp;
@@ -993,8 +2678,8 @@ if(debug)fprintf(stderr,"idbuf = %s\n",idbuf);
 		while( *s && *s != ',' ) *cp++ =  *s++;
 		while( cp < &idbuf[XNAMELN] ) *cp++ = 0;
 		ch = *s;
-		j = lookup( seghash , SEGHASH, idbuf);
-		if( j == -1 ) *hpos = j = install( idbuf );
+		j = lookup( &seghash, idbuf );
+		if( j == -1 ) hadd( j = install( idbuf ) );
 		syp = &symtab[ j ];
 		j = syp->x_sy_sg & 0177;
 		if( j != 127 && j != i ){
@@ -1110,26 +2795,71 @@ int findseg(int typ, uns siz)
 }
 
 
-void flshbuf(void)
+/*
+ * inopen - Map the whole of infile for pass2, or read it in where it
+ * can't be mapped.
+ */
+void inopen(void)
 {
-	if( dirty ){
-		lseek( objfile, bpos, 0 );
-		write( objfile, buf, blen );
-		dirty = 0;
-		bpos = 1;
+	struct stat st;
+
+	if( fstat( infile, &st ) < 0 ) errex( "p2 can't stat %s", fname );
+	insiz = st.st_size;
+	inpos = 0;
+	inmapped = 0;
+	if( insiz == 0 ){
+		inmap = NULL;
+	} else {
+		inmap = mmap( NULL, insiz, PROT_READ, MAP_PRIVATE, infile, 0 );
+		if( inmap != MAP_FAILED ){
+			inmapped = 1;
+		} else {
+			inmap = malloc( insiz );
+			if( inmap == NULL ) errex( "out of memory for %s", fname );
+			if( read( infile, inmap, insiz ) != insiz )
+				errex( "bad read in %s", fname );
+		}
 	}
+	close( infile );
 }
 
 
-void getbuf(long p)
+/*
+ * inkeep - Hold on to the mapped input until pass2 is done with it.
+ */
+void inkeep(void)
 {
-	p &= -512;
-	if( bpos != p ){
-		if( dirty ) flshbuf();
-		bpos = p;
-		lseek( objifile, bpos, 0 );
-		blen = read( objifile, buf, 512 );
-	}
+	inmaps = grow( inmaps, &ninmapt, ninmaps, sizeof *inmaps );
+	inmaps[ ninmaps ].map = inmap;
+	inmaps[ ninmaps ].siz = insiz;
+	inmaps[ ninmaps ].mapped = inmapped;
+	ninmaps++;
+	inmap = NULL;
+}
+
+
+void inclose(void)
+{
+	if( inmapped )
+		munmap( inmap, insiz );
+	else
+		free( inmap );
+	inmap = NULL;
+}
+
+
+/*
+ * inread - Take the next n bytes of the mapped input, or NULL if the
+ * file ends first.
+ */
+char *inread(long n)
+{
+	char *p;
+
+	if( n < 0 || inpos + n > insiz ) return( NULL );
+	p = inmap + inpos;
+	inpos += n;
+	return( p );
 }
 
 
@@ -1149,61 +2879,155 @@ int idmatch(char *a, char *b)
 int install(char *s)
 {
 	reg char *cp;
-	int i;
+	int i, k;
 
 	i = symlev;
-	if( i >= SYMNO ) errex( "symbol table overflow" );
+	symtab = grow( symtab, &nsymtab, i, sizeof *symtab );
 	symtab[ i ].x_sy_sg = 255;
 	symtab[ i ].x_sy_fl = X_SY_UNX;
+	symtab[ i ].x_sy_val = 0;
 	cp = symtab[ i ].x_sy_name;
-	while( (*cp++ = *s++) );
+	for( k=0; k < XNAMELN; k++ )
+		if( (*cp++ = *s) ) s++;
 	symlev++;
 	return( i );
 }
 
 
-int lookup(short *htab, int HTAB, char *sym)
+/*
+ * lookup - Find sym in the hash table h.  Returns its symtab index, or
+ * -1 after noting the free slot, which hadd() then fills.
+ */
+int lookup(struct htab *h, char *sym)
 {
 	reg int i, j;
-	reg char *cp;
-	int k;
-
-	i = 0;
-	cp = sym;
-	for(k = 0; k < XNAMELN && *cp; k++) i = i*5 + *cp++;
-	i &= HTAB-1;
-	for( k=0; k<2; k++ ){
-		while( i < HTAB ){
-			if( ( j = htab[ i ]) ){
-				if( idmatch( sym, symtab[ j ].x_sy_name ))
-					return( j );
-			} else {
-				hpos = &htab[ i ];
-				return( -1 );
-			}
-			i++;
-		}
-		i = 0;
+
+	if( h->size == 0 ) hsize( h, 64 );
+	i = hashname( sym ) & (h->size-1);
+	while( ( j = h->slot[ i ]) ){
+		if( idmatch( sym, symtab[ j ].x_sy_name ))
+			return( j );
+		i = (i+1) & (h->size-1);
+	}
+	hcur = h;
+	hslot = i;
+	return( -1 );
+}
+
+
+/*
+ * hadd - Enter symtab index j where the last lookup() missed.
+ */
+void hadd(int j)
+{
+	hcur->slot[ hslot ] = j;
+	if( ++hcur->count * 4 > hcur->size * 3 ) hsize( hcur, hcur->size * 2 );
+	hcur = NULL;
+}
+
+
+/*
+ * hsize - Rebuild the hash table h with n slots.
+ */
+void hsize(struct htab *h, int n)
+{
+	reg int i, j, k;
+	int *old, oldn;
+
+	old = h->slot;
+	oldn = h->size;
+	h->slot = calloc( n, sizeof( int ) );
+	if( h->slot == NULL ) errex( "out of memory" );
+	h->size = n;
+	for( i=0; i<oldn; i++ ){
+		if( (j = old[ i ]) == 0 ) continue;
+		k = hashname( symtab[ j ].x_sy_name ) & (n-1);
+		while( h->slot[ k ] ) k = (k+1) & (n-1);
+		h->slot[ k ] = j;
 	}
-	errex( "hash table overflow: %d", HTAB );
-	return -1; /* not reached */
+	free( old );
 }
 
 
-int mk_outfile(char *s)
+/*
+ * hashname - FNV-1a over the (up to XNAMELN) bytes of a symbol name.
+ */
+unsigned hashname(char *s)
 {
+	reg unsigned h;
+	reg int k;
+
+	h = 2166136261u;
+	for( k=0; k < XNAMELN && s[k]; k++ ){
+		h ^= (unsigned char)s[k];
+		h *= 16777619u;
+	}
+	return( h ^ (h >> 16) );
+}
+
+
+/*
+ * grow - Make room for element n in the table t, which has *np elements
+ * of size sz, doubling it as often as needed.  New elements are zeroed.
+ */
+void *grow(void *t, int *np, long n, size_t sz)
+{
+	long m;
+
+	if( n < *np ) return( t );
+	m = *np ? *np : 64;
+	while( m <= n ) m *= 2;
+	t = realloc( t, m * sz );
+	if( t == NULL ) errex( "out of memory" );
+	memset( (char *)t + *np * sz, 0, (m - *np) * sz );
+	*np = m;
+	return( t );
+}
+
+
+/*
+ * mapgrow - Make room in map for entry n and for any segment number a
+ * module might name after it.  Unassigned entries read as 255.
+ */
+void mapgrow(long n)
+{
+	int old;
+
+	old = nmap;
+	map = grow( map, &nmap, n + MSEGNO, sizeof *map );
+	if( nmap > old ) memset( map + old, 255, nmap - old );
+}
+
+
+/*
+ * mk_tmpfile - An unnamed scratch file, gone when it is closed.
+ */
+int mk_tmpfile(void)
+{
+	char name[32];
 	int i;
 
-	close( creatb( s , 0666 ) );
-	i = openb( s , 2 );
+#ifdef O_TMPFILE
+	if( (i = open( "/tmp", O_TMPFILE | O_RDWR, 0600 )) >= 0 )
+		return( i );
+#endif
+	strcpy( name, "/tmp/ld8kXXXXXX" );
+	if( (i = mkstemp( name )) >= 0 ) unlink( name );
 	return( i );
 }
 
 
+/*
+ * putrel - Keep a relocation item for the -r output.  They stay in
+ * rlobuf, and only go out to a scratch file if there are more than
+ * RLMAX of them.
+ */
 void putrel(struct x_rel *rlp)
 {
-	if( rlo >= RLC ) wrrel();
+	if( rlo >= RLMAX ) wrrel();
+	rlobuf = grow( rlobuf, &nrlobuf, rlo, sizeof *rlobuf );
 	rlobuf[ rlo++ ] = *rlp;
+	relcnt++;
 }
 
 
@@ -1245,9 +3069,13 @@ void wrrel(void)
 	int i;
 
 	if( rlo ){
+		if( relfile < 0 && (relfile = mk_tmpfile()) < 0 )
+			errex( "can't create relocation scratch file" );
 		/* swap to big-endian before writing */
 		for( i=0; i<rlo; i++ ) swap_rel( &rlobuf[i] );
-		write( relfile, rlobuf, rlo * sizeof( struct x_rel ) );
+		if( write( relfile, rlobuf, rlo * sizeof( struct x_rel ) )
+				!= rlo * sizeof( struct x_rel ) )
+			errex( "bad write on relocation scratch file" );
 		rlo = 0;
 	}
 }
@@ -45,13 +45,34 @@
  * Constants.
  */
 #define	EXTMAX	(RBMSK+1-RBEXT)	/* Maximum number of external symbols allowed */
-#define	SEGMAX	128		/* Maximum number of segments allowed */
+#define	SEGMAX	256		/* Maximum number of segments allowed */
 
 /*
  * Type definitions.
  */
 typedef unsigned short uns;
 
+struct osym {			/* A symbol, as the .obj file gave it */
+    char *name;
+    int type;
+    uns value;
+    int segment;
+};
+
+struct orel {			/* A relocation entry, likewise */
+    int type;
+    uns offset;
+    int segment;
+    uns base;
+};
+
+struct otxt {			/* A text block, still in objdata */
+    char *ptr;
+    uns offset;
+    int segment;
+    int count;
+};
+
 /*
  * Global variables.
  */
@@ -62,25 +83,29 @@ struct x_sg segtab[SEGMAX];	/* Table of information about segments */
 
 struct x_hdr header;		/* Header for x.out file */
 
-long curoff;			/* Current x.out file offset */
-long reloff;			/* X.out file offset for next reloc. entry */
 long segoff[SEGMAX];		/* X.out file offsets for segments */
-long symoff;			/* X.out file offset for next symbol */
+long reloff;			/* X.out file offset of the relocation part */
 
-uns symct;			/* Number of symbols for the x.out file */
+struct osym *symtab;		/* The symbols, in .obj order */
+struct orel *reltab;		/* The relocation entries */
+struct otxt *txttab;		/* The text blocks */
+int symct, relct, txtct;	/* Number of entries in each */
+int symmax, relmax, txtmax;	/* And room for */
 
 char dbgflg = 0;		/* Debug output flag on =1 off =0 */
-char objbuf[255];		/* Buffer holding body of current .obj block */
-FILE *objiop;			/* Standard I/O pointer for .obj file */
+char *objdata;			/* The whole .obj file */
+char *objend;			/* Its end */
+char *objin;			/* Next block in objdata */
 char *objname;			/* Name of .obj file */
-char *objpt, *objtop;		/* Pointers into objbuf */
+char *objpt, *objtop;		/* Pointers into the current block */
 int objtyp;			/* Type of current .obj block */
 
+char *outbuf;			/* The x.out file, built up in memory */
+char *outpt;			/* Next byte of outbuf to fill */
 int outfd;			/* File descriptor for x.out file */
 char *outname = "x.out";	/* Name of x.out file */
 
 int firstseg;			/* First segment (0 or 1) actually output */
-char pass2;			/* Flag set for second pass over .obj file */
 
 char *prname;			/* Name of this program */
 
@@ -88,6 +113,7 @@ char *prname;			/* Name of this program */
 /*
  * Function declarations.
  */
+void *addent(void **tabp, int *ctp, int *maxp, size_t size);
 void dopass(void);
 void ferr(const char *a, ...);
 void init(int argc, char **argv);
@@ -100,10 +126,10 @@ uns  ogetw(void);
 void outb(char val);
 void outhdr(void);
 void outl(long val);
-void outrel(int type, uns offset, int segment, uns base);
+void outrel(struct orel *rp);
 void outseg(void);
-void outsym(const char *name, int type, unsigned short value, int segment);
-void outtxt(uns offset, int segment, char *txtptr, int txtct);
+void outsym(struct osym *sp);
+void outtxt(struct otxt *tp);
 void outw(uns val);
 void usage(void);
 
@@ -113,19 +139,43 @@ void usage(void);
  */
 int main(int argc, char **argv)
 {
+    int i;
+    long len;
+
     init(argc, argv);
     dopass();
     interlude();
-    pass2 = 1;
-    rewind(objiop);
-    dopass();
+    for(i=0 ; i<txtct ; i++)
+	outtxt(&txttab[i]);
+    outpt = outbuf + reloff;
+    for(i=0 ; i<relct ; i++)
+	outrel(&reltab[i]);
+    for(i=0 ; i<symct ; i++)
+	outsym(&symtab[i]);
+    len = outpt - outbuf;
+    if(write(outfd, outbuf, len) != len)
+	ferr("Cannot write %s\n", outname);
     close(outfd);
-    fclose(objiop);
     return(0);
 }
 
 /*
- * dopass - Performs a scan of the .obj file.
+ * addent - Makes room for one more entry in a table, doubling it as
+ * needed, and returns a pointer to the new entry.
+ */
+void *addent(void **tabp, int *ctp, int *maxp, size_t size)
+{
+    if(*ctp >= *maxp) {
+	*maxp = *maxp ? *maxp * 2 : 64;
+	if((*tabp = realloc(*tabp, *maxp * size)) == NULL)
+	    ferr("Out of memory\n");
+    }
+    return((char *)*tabp + (*ctp)++ * size);
+}
+
+/*
+ * dopass - Scans the .obj file once, sizing the segments and collecting
+ * the symbols, relocation entries and text blocks for the x.out file.
  */
 void dopass(void)
 {
@@ -134,11 +184,13 @@ void dopass(void)
     uns base;
     uns len;
     uns relent;
-    uns relpos;
     uns sec;
     char *sym;
     int type;
     uns val;
+    struct osym *sp;
+    struct orel *rp;
+    struct otxt *tp;
 
     header.x_nseg = 1;
     if(ofill() != OBOST)
@@ -152,44 +204,48 @@ void dopass(void)
 		ogetb();
 		ogetb();
 		sym = ogets();
-		if(pass2 && dbgflg) printf("sections %s\n",sym);
-		if(!pass2) {
-		    segtab[header.x_nseg].x_sg_no = 255;
-		    if (strcmp(sym,"__text")== 0)
-			segtab[header.x_nseg].x_sg_typ = X_SG_COD;
-		    if (strcmp(sym,"__con")== 0)
-			segtab[header.x_nseg].x_sg_typ = X_SG_CON;
-		    if (strcmp(sym,"__data")== 0)
-			segtab[header.x_nseg].x_sg_typ = X_SG_DAT;
-		    if (strcmp(sym,"__bss")== 0)
-			segtab[header.x_nseg].x_sg_typ = X_SG_BSS;
-		    header.x_symb += sizeof(struct x_sym);
-		    symct++;
-		} else
-		    outsym(sym, X_SY_SEG, 0, header.x_nseg);
+		if(dbgflg) printf("sections %s\n",sym);
+		if(header.x_nseg >= SEGMAX)
+		    ferr("Too many sections\n");
+		/* the type goes by the name; c1z8k -F adds a number */
+		segtab[header.x_nseg].x_sg_no = 255;
+		if (strncmp(sym,"__text",6)== 0)
+		    segtab[header.x_nseg].x_sg_typ = X_SG_COD;
+		if (strncmp(sym,"__con",5)== 0)
+		    segtab[header.x_nseg].x_sg_typ = X_SG_CON;
+		if (strncmp(sym,"__data",6)== 0)
+		    segtab[header.x_nseg].x_sg_typ = X_SG_DAT;
+		if (strncmp(sym,"__bss",5)== 0)
+		    segtab[header.x_nseg].x_sg_typ = X_SG_BSS;
+		sp = addent((void **)&symtab, &symct, &symmax, sizeof *symtab);
+		sp->name = sym;
+		sp->type = X_SY_SEG;
+		sp->value = 0;
+		sp->segment = header.x_nseg;
 		header.x_nseg++;
 	    }
 	    break;
 
 	case OBGLO:	/* Global symbols block */
-	    if(pass2 && dbgflg) printf("global ");
+	    if(dbgflg) printf("global ");
 	case OBLOC:	/* Local symbols block */
-	    if(pass2 && dbgflg) printf("symbols block\n");
+	    if(dbgflg) printf("symbols block\n");
 	    while(objpt < objtop) {
 		val = (uns)ogetl();
 		sec = ogetb();
 		sym = ogets();
-		if(!pass2) {
-		    if(sec == RBUND)
-			*exttop++ = symct;
-		    header.x_symb += sizeof(struct x_sym);
-		    symct++;
-		} else {
-		    type = objtyp==OBGLO ? X_SY_GLB : X_SY_LOC;
-		    if(sec == RBUND)
-			type = X_SY_UNX;
-		    outsym(sym, type, val, sec);
+		type = objtyp==OBGLO ? X_SY_GLB : X_SY_LOC;
+		if(sec == RBUND) {
+		    if(exttop >= &exttab[EXTMAX])
+			ferr("Too many external symbols\n");
+		    *exttop++ = symct;
+		    type = X_SY_UNX;
 		}
+		sp = addent((void **)&symtab, &symct, &symmax, sizeof *symtab);
+		sp->name = sym;
+		sp->type = type;
+		sp->value = val;
+		sp->segment = sec;
 	    }
 	    break;
 
@@ -197,57 +253,62 @@ void dopass(void)
 	    adr = (uns)ogetl();
 	    sec = ogetb();
 	    len = ogetb();
-	    if(pass2 && dbgflg)
+	    if(dbgflg)
 		printf("text section[%x] at %x for %x bytes\n",sec,adr,len);
-	    if(!pass2) {
-		if(adr+len > segtab[sec].x_sg_len)
-		    segtab[sec].x_sg_len = adr+len;
-		objpt += len;
-		while(objpt < objtop) {
-		    ogetb();
-		    relent = ogetw();
-		    header.x_reloc += sizeof(struct x_rel);
-		    relent &= RAMSK;
-		    if(relent==RAZLS || relent==RAZSS || relent==RAZOF)
-			header.x_magic = X_SU_MAGIC;
-		}
-	    } else {
-		outtxt(adr, sec, objpt, len);
-		objpt += len;
-		while(objpt < objtop) {
-		    relpos = adr + ogetb() - 6;
-		    relent = ogetw();
-		    action = relent & RAMSK;
-		    base = relent & RBMSK;
-		    switch(action) {
-
-		    case RAA32M:
-			relpos += 2;
-			/* Fall through */
-
-		    case RAA16M:
-		    case RAZOF:
-			type = base<RBEXT ? X_RL_OFF : X_RL_XOF;
-			break;
-
-		    case RAZSS:
-			type = base<RBEXT ? X_RL_SSG : X_RL_XSSG;
-			break;
-
-		    case RAZLS:
-			type = base<RBEXT ? X_RL_LSG : X_RL_XLSG;
-			break;
-
-		    default:
-			ferr("Illegal reloc. 0x%x at loc. 0x%x of sec. 0x%x\n",
-			relent, relpos, sec);
-		    }
-		    outrel(type, relpos, sec, base);
+	    if(adr+len > segtab[sec].x_sg_len)
+		segtab[sec].x_sg_len = adr+len;
+	    if(objpt + len > objtop)
+		ferr("Off the end of objbuf\n");
+	    tp = addent((void **)&txttab, &txtct, &txtmax, sizeof *txttab);
+	    tp->ptr = objpt;
+	    tp->offset = adr;
+	    tp->segment = sec;
+	    tp->count = len;
+	    objpt += len;
+	    while(objpt < objtop) {
+		rp = addent((void **)&reltab, &relct, &relmax, sizeof *reltab);
+		rp->offset = adr + ogetb() - 6;
+		relent = ogetw();
+		action = relent & RAMSK;
+		base = relent & RBMSK;
+		switch(action) {
+
+		case RAA32M:
+		    rp->offset += 2;
+		    /* Fall through */
+
+		case RAA16M:
+		case RAZOF:
+		    type = base<RBEXT ? X_RL_OFF : X_RL_XOF;
+		    break;
+
+		case RAZSS:
+		    type = base<RBEXT ? X_RL_SSG : X_RL_XSSG;
+		    break;
+
+		case RAZLS:
+		    type = base<RBEXT ? X_RL_LSG : X_RL_XLSG;
+		    break;
+
+		case RAZNOT:
+		    type = X_RL_NOTE;
+		    break;
+
+		default:
+		    ferr("Illegal reloc. 0x%x at loc. 0x%x of sec. 0x%x\n",
+		    relent, rp->offset, sec);
 		}
+		if(action==RAZLS || action==RAZSS || action==RAZOF)
+		    header.x_magic = X_SU_MAGIC;
+		rp->type = type;
+		rp->segment = sec;
+		rp->base = base;
 	    }
 	    break;
 	}
     }
+    header.x_reloc = relct * sizeof(struct x_rel);
+    header.x_symb = symct * sizeof(struct x_sym);
 }
 
 /*
@@ -268,6 +329,8 @@ void ferr(const char *a, ...)
 void init(int argc, char **argv)
 {
     char *ap;
+    FILE *objiop;
+    long len;
 
     prname = argv[0];
     argv[argc] = (char *)0;
@@ -306,12 +369,23 @@ void init(int argc, char **argv)
 	ferr("Cannot open %s\n", objname);
     if(strcmp(objname, outname) == 0)
 	ferr("Would destroy %s\n", objname);
+    fseek(objiop, 0L, SEEK_END);
+    len = ftell(objiop);
+    rewind(objiop);
+    if((objdata = malloc(len + 1)) == NULL)
+	ferr("Out of memory\n");
+    if(len < 0 || fread(objdata, 1, len, objiop) != len)
+	ferr("Cannot read %s\n", objname);
+    fclose(objiop);
+    objin = objdata;
+    objend = objdata + len;
 
     segtab[0].x_sg_typ = X_SG_BSS;
 }
 
 /*
- * interlude - Performs interpass processing.
+ * interlude - Lays out the x.out file once the .obj file has been read,
+ * and starts it off in outbuf with the header and the segments.
  */
 void interlude(void)
 {
@@ -339,28 +413,30 @@ void interlude(void)
 	}
     }
     reloff = off;
-    symoff = reloff + header.x_reloc;
 
-    curoff = 0L;
+    off += header.x_reloc + header.x_symb;
+    if((outbuf = calloc(off, 1)) == NULL)
+	ferr("Out of memory\n");
+    outpt = outbuf;
     outhdr();
     outseg();
 }
 
 /*
- * ofill - Reads the next object block into objbuf.
+ * ofill - Steps to the next object block, which objpt and objtop then
+ * bound in objdata.
  */
 int ofill(void)
 {
-    int ch;
-
-    if((objtyp = getc(objiop)) == EOF) return(0);
-    if((ch = getc(objiop)) == EOF) ferr("Premature EOF\n");
-    objtop = &objbuf[ch];
-    for(objpt=objbuf ; objpt<objtop ; objpt++) {
-	if((ch = getc(objiop)) == EOF) ferr("Premature EOF\n");
-	*objpt = ch;
-    }
-    objpt = objbuf;
+    int len;
+
+    if(objin >= objend) return(0);
+    objtyp = *objin++ & 0377;
+    if(objin >= objend) ferr("Premature EOF\n");
+    len = *objin++ & 0377;
+    if(objin + len > objend) ferr("Premature EOF\n");
+    objpt = objin;
+    objtop = objin += len;
     return(objtyp);
 }
 
@@ -413,8 +489,7 @@ uns ogetw(void)
  */
 void outb(char val)
 {
-    write(outfd, &val, 1);
-    curoff++;
+    *outpt++ = val;
 }
 
 /*
@@ -435,35 +510,28 @@ void outhdr(void)
  */
 void outl(long val)
 {
-    char buf[4];
-
-    buf[3] = val;
-    val >>= 8;
-    buf[2] = val;
-    val >>= 8;
-    buf[1] = val;
-    val >>= 8;
-    buf[0] = val;
-    write(outfd, buf, 4);
-    curoff += 4;
+    outw(val >> 16);
+    outw(val);
 }
 
 /*
  * outrel - Outputs a relocation entry.
  */
-void outrel(int type, uns offset, int segment, uns base)
+void outrel(struct orel *rp)
 {
-    if(curoff != reloff)
-	lseek(outfd, curoff = reloff, 0);
-    if(base >= RBEXT)
+    uns base;
+
+    base = rp->base;
+    if(rp->type == X_RL_NOTE)
+	;			/* base is an X_NT_ code */
+    else if(base >= RBEXT)
 	base = exttab[base-RBEXT];
     else
 	base -= firstseg;
-    outb(segment - firstseg);
-    outb(type);
-    outw(offset);
+    outb(rp->segment - firstseg);
+    outb(rp->type);
+    outw(rp->offset);
     outw(base);
-    reloff = curoff;
 }
 
 /*
@@ -483,39 +551,43 @@ void outseg(void)
 /*
  * outsym - Outputs a symbol table entry.
  */
-void outsym(const char *name, int type, unsigned short value, int segment)
+void outsym(struct osym *sp)
 {
-    int i;
+    int i, segment;
+    char *name;
 
-    if(curoff != symoff)
-	lseek(outfd, curoff = symoff, 0);
+    segment = sp->segment;
     if(segment==RBABS || segment==RBUND)
 	segment = 255;
     else
 	segment -= firstseg;
     outb(segment);
-    outb(type);
-    outw(value);
+    outb(sp->type);
+    outw(sp->value);
+    name = sp->name;
     for(i=0 ; i<XNAMELN ; i++) {
 	outb(*name);
 	if(*name != '\0')
 	    name++;
     }
-    symoff = curoff;
 }
 
 /*
- * outtxt - Outputs a block of text for the specified segment.
+ * outtxt - Puts a block of text in its place in the segment data.
+ * Whatever would run past the initialized part is dropped.
  */
-void outtxt(uns offset, int segment, char *txtptr, int txtct)
+void outtxt(struct otxt *tp)
 {
-    long txtoff;
-
-    txtoff = segoff[segment] + (long)offset;
-    if(curoff != txtoff)
-	lseek(outfd, curoff = txtoff, 0);
-    write(outfd, txtptr, txtct);
-    curoff += txtct;
+    long txtoff, n;
+
+    if(tp->segment >= header.x_nseg)
+	return;
+    txtoff = segoff[tp->segment] + (long)tp->offset;
+    n = tp->count;
+    if(txtoff + n > reloff)
+	n = reloff - txtoff;
+    if(n > 0)
+	memcpy(outbuf + txtoff, tp->ptr, n);
 }
 
 /*
@@ -523,13 +595,8 @@ void outtxt(uns offset, int segment, char *txtptr, int txtct)
  */
 void outw(uns val)
 {
-    char buf[2];
-
-    buf[1] = val;
-    val >>= 8;
-    buf[0] = val;
-    write(outfd, buf, 2);
-    curoff += 2;
+    outb(val >> 8);
+    outb(val);
 }
 
 /*
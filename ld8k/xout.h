@@ -66,6 +66,14 @@ struct x_rel {			/* relocation item */
 #define X_RL_XOF	5	/* adjust a 16 bit offset by an external */
 #define X_RL_XSSG	6	/* adjust a short seg ref by an external */
 #define X_RL_XLSG	7	/* adjust a long seg ref by an external */
+#define X_RL_NOTE	010	/* nothing to adjust: x_rl_bas says what the
+				   instruction at x_rl_loc is (see below) */
+
+#define X_NT_JMP	1	/* jp cc,address or call address */
+#define X_NT_R7		2	/* 7-bit relative address (djnz) */
+#define X_NT_R8		3	/* 8-bit relative address (jr) */
+#define X_NT_R12	4	/* 12-bit relative address (calr) */
+#define X_NT_R16	5	/* 16-bit relative address (ldr, ldar) */
 
 #define XNAMELN	8		/* length of a symbol */
 
@@ -149,4 +157,22 @@ static inline void swap_ar(struct ar8k_hd *a)
 	a->ar8k_size = ntohl(a->ar8k_size);
 }
 
+/*
+ * Archive symbol directory.  ar8k keeps it as the first member of the
+ * archive, under the name AR8KDIR.  It holds one entry per global symbol
+ * defined by a member, in member order, giving the file offset of that
+ * member's header.
+ */
+#define AR8KDIR		"__.SYMDEF"
+
+struct ar8k_sym {
+	char		ar8k_sy_name[XNAMELN];	/* symbol name, padded with 0's */
+	int32_t		ar8k_sy_pos;	/* offset of the defining member header */
+} __attribute__((packed));
+
+static inline void swap_arsym(struct ar8k_sym *s)
+{
+	s->ar8k_sy_pos = ntohl(s->ar8k_sy_pos);
+}
+
 #endif /* XOUT_H */
@@ -0,0 +1,5 @@
+; assembled with -j next to sizing_if.s: its diagnostics and error
+; count must name this file
+	ld r0,#1
+	jr nowhere
+	.end
@@ -1,5 +1,6 @@
 #!/bin/bash
-# Asm test suite: compile + assemble, check for asz8k errors
+# Asm test suite: compile + assemble, check for asz8k errors, and check
+# that asz8k -X writes the same x.out as xcon makes from the .obj
 # Reuses codegen test sources — validates the assembler accepts our output.
 #
 # asz8k reports E errors on external/global symbol DA-mode references
@@ -12,6 +13,18 @@ source "$SUITEDIR/../common.sh"
 
 CODEGEN_DIR="$SUITEDIR/../codegen"
 
+# assemble_x <source.s> <output.out>
+#   Runs asz8k -X, which writes x.out itself instead of chaining to xcon.
+assemble_x() {
+    local asmtmp
+    asmtmp=$(mktemp -d)
+    cp "$1" "$asmtmp/t.s"
+    ( cd "$asmtmp" && "$ASZ8K" -X -o t.out t.s >/dev/null 2>&1 )
+    rm -f "$2"
+    [ -f "$asmtmp/t.out" ] && cp "$asmtmp/t.out" "$2"
+    rm -rf "$asmtmp"
+}
+
 for src in "$CODEGEN_DIR"/test_*.c; do
     name=$(basename "$src" .c)
     out_s="$SUITEDIR/output/${name}.s"
@@ -34,6 +47,7 @@ for src in "$CODEGEN_DIR"/test_*.c; do
 
     # Step 2: assemble
     assemble "$out_s" "$out_obj"
+    asm_rc=$?
 
     if [ ! -f "$out_obj" ]; then
         echo "FAIL $name (asz8k produced no .obj)"
@@ -50,6 +64,16 @@ for src in "$CODEGEN_DIR"/test_*.c; do
         continue
     fi
 
+    # Step 4: asz8k -X must write the same x.out as .obj + xcon.  Like
+    # the chain to xcon, -X writes nothing when there were errors.
+    assemble_x "$out_s" "$SUITEDIR/output/${name}.X.out"
+    if [ $asm_rc -eq 0 ] &&
+            ! cmp -s "$out_xout" "$SUITEDIR/output/${name}.X.out"; then
+        echo "FAIL $name (asz8k -X differs from xcon)"
+        fail=$((fail+1))
+        continue
+    fi
+
     if [ ${asm_E_count:-0} -gt 0 ]; then
         echo "PASS $name (${asm_E_count} relocation E warnings)"
     else
@@ -58,6 +82,76 @@ for src in "$CODEGEN_DIR"/test_*.c; do
     pass=$((pass+1))
 done
 
+# Hand-written cases for assembler options, each assembled in a temp
+# directory like assemble() does
+
+# asm_opts <name> <asz8k flags...>
+#   Assembles asm/<name>.s with the given flags into $asmdir/t.obj.
+#   Returns asz8k's exit status, with its output in $asm_errors.
+asm_opts() {
+    local name="$1"
+    shift
+    cp "$SUITEDIR/$name.s" "$asmdir/t.s"
+    rm -f "$asmdir/t.obj"
+    asm_errors=$( cd "$asmdir" && "$ASZ8K" "$@" t.s 2>&1 )
+}
+
+asmdir=$(mktemp -d)
+
+# -r: a .if that depends on label distances follows the sized branches
+if asm_opts sizing_if && cp "$asmdir/t.obj" "$asmdir/plain.obj" &&
+        asm_opts sizing_if -r && cmp -s "$asmdir/t.obj" "$asmdir/plain.obj"; then
+    echo "PASS sizing_if"
+    pass=$((pass+1))
+else
+    echo "FAIL sizing_if"
+    echo "$asm_errors" | head -5
+    fail=$((fail+1))
+fi
+
+# -r: a short forward jr after a run of branches that grew stays short
+if asm_opts sizing_near_hand && cp "$asmdir/t.obj" "$asmdir/hand.obj" &&
+        asm_opts sizing_near -r && cmp -s "$asmdir/t.obj" "$asmdir/hand.obj"; then
+    echo "PASS sizing_near"
+    pass=$((pass+1))
+else
+    echo "FAIL sizing_near"
+    echo "$asm_errors" | head -5
+    fail=$((fail+1))
+fi
+
+# -X on the link suite's hand-written modules, which have no errors and
+# use externals, linker notes and data relocation
+for src in "$SUITEDIR"/../link/*.s; do
+    name=$(basename "$src" .s)
+    assemble "$src" "$asmdir/x.obj"
+    obj_to_xout "$asmdir/x.obj" "$asmdir/x.out" >/dev/null
+    assemble_x "$src" "$asmdir/x.X.out"
+    if [ -f "$asmdir/x.out" ] && cmp -s "$asmdir/x.out" "$asmdir/x.X.out"; then
+        echo "PASS xout_$name"
+        pass=$((pass+1))
+    else
+        echo "FAIL xout_$name (asz8k -X differs from xcon)"
+        fail=$((fail+1))
+    fi
+    rm -f "$asmdir"/x.*
+done
+
+# -j: each file's diagnostics and error count are prefixed with its name
+cp "$SUITEDIR/jobs_err.s" "$SUITEDIR/sizing_if.s" "$asmdir"
+asm_errors=$( cd "$asmdir" && "$ASZ8K" -j 2 sizing_if.s jobs_err.s 2>&1 )
+if [ $? -ne 0 ] && echo "$asm_errors" | grep -q '^jobs_err\.s: 2 errors' &&
+        [ -z "$(echo "$asm_errors" | grep -v '^jobs_err\.s: ')" ]; then
+    echo "PASS jobs_prefix"
+    pass=$((pass+1))
+else
+    echo "FAIL jobs_prefix"
+    echo "$asm_errors" | head -5
+    fail=$((fail+1))
+fi
+
+rm -rf "$asmdir"
+
 echo ""
 echo "asm: $pass passed, $fail failed, $skip skipped"
 print_summary
@@ -0,0 +1,12 @@
+; a .if on the distance between labels, assembled with -r: the sizing
+; passes must evaluate it again rather than reuse pass 1's outcome
+start:
+	jp far
+	.block 260
+mid:
+	.if mid-start-262
+	ld r0,#1
+	.endif
+far:
+	ret
+	.end
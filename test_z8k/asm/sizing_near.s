@@ -0,0 +1,14 @@
+; 150 forward jr's that grow to jp, then a jr whose target is close by,
+; assembled with -r: the growth of the jr's ahead of it must not count
+; against it, so it stays a jr as in sizing_near_hand.s
+	.repeat 150
+	jr z,far
+	.endr
+	jr z,near
+	nop
+near:
+	nop
+	.block 600
+far:
+	ret
+	.end
@@ -0,0 +1,12 @@
+; sizing_near.s as -r should size it, written out by hand
+	.repeat 150
+	jp z,far
+	.endr
+	jr z,near
+	nop
+near:
+	nop
+	.block 600
+far:
+	ret
+	.end
@@ -9,9 +9,9 @@ CP68="$CROSS/cpp/cp68"
 C068="$CROSS/parser/c068"
 C1Z8K="$CROSS/cgen_z8k/c1z8k"
 ASZ8K="$CROSS/asz8k/asz8k"
-ASZ8K_PD="$CROSS/asz8k/asz8k.pd"
 XCON="$CROSS/ld8k/xcon"
 LD8K="$CROSS/ld8k/ld8k"
+AR8K="$CROSS/ld8k/ar8k"
 XOUT2BIN="$TESTDIR/tools/xout2bin.py"
 EMU="$CROSS/z8000_emu/build/z8000emu"
 
@@ -67,8 +67,6 @@ assemble() {
     local asmtmp
     asmtmp=$(mktemp -d)
 
-    # asz8k needs its predefined symbols file in CWD
-    cp "$ASZ8K_PD" "$asmtmp/asz8k.pd"
     cp "$src" "$asmtmp/t.s"
 
     asm_errors=$( cd "$asmtmp" && "$ASZ8K" -l t.s 2>&1 )
@@ -103,6 +101,14 @@ link_xout() {
     "$LD8K" -o "$out" "$@" 2>&1
 }
 
+# link_bin <output.bin> <input1.out> [<input2.out> ...]
+#   Runs ld8k to link x.out files straight into a flat binary.
+link_bin() {
+    local out="$1"
+    shift
+    "$LD8K" -F bin -o "$out" "$@" 2>&1
+}
+
 # xout_to_bin <input.out> <output.bin>
 #   Converts x.out to flat binary using xout2bin.py.
 xout_to_bin() {
@@ -111,6 +117,21 @@ xout_to_bin() {
     python3 "$XOUT2BIN" "$xout" "$bin" 2>&1
 }
 
+# same_bin <output.bin> <ld8k flags...> -- <input.out ...>
+#   Links with -F bin and again to x.out, and compares the flat binary
+#   with what xout2bin.py makes of the x.out (left in <output.bin>.ref).
+#   Returns 0 if both links work and the binaries are the same.
+same_bin() {
+    local bin="$1" flags=()
+    shift
+    while [ "$1" != "--" ]; do flags+=("$1"); shift; done
+    shift
+    "$LD8K" "${flags[@]}" -F bin -o "$bin" "$@" >/dev/null 2>&1 &&
+    "$LD8K" "${flags[@]}" -o "$bin.out" "$@" >/dev/null 2>&1 &&
+    xout_to_bin "$bin.out" "$bin.ref" >/dev/null &&
+    cmp -s "$bin" "$bin.ref"
+}
+
 # run_emu <binary> [extra_args...]
 #   Runs the Z8000 emulator, returns R0 value (decimal) in $emu_r0.
 #   Sets emu_output to full emulator output.
@@ -0,0 +1,5 @@
+#ifndef AFTER_H
+#define AFTER_H
+int inside;
+#endif
+int after;
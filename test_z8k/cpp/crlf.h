@@ -0,0 +1,4 @@
+/* a header with CRLF line ends */
+int in_header;
+
+int header_end;
@@ -0,0 +1,6 @@
+#ifndef ELSE_H
+#define ELSE_H
+int first;
+#else
+int again;
+#endif
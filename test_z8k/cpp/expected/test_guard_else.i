@@ -0,0 +1,19 @@
+# 1 "test_guard_else.c"
+  
+# 1 "else.h"
+ 
+ 
+int first; 
+ 
+ 
+ 
+# 3 "test_guard_else.c"
+# 1 "else.h"
+ 
+ 
+ 
+ 
+int again; 
+ 
+# 4 "test_guard_else.c"
+int end; 
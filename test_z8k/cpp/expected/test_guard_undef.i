@@ -0,0 +1,18 @@
+# 1 "test_guard_undef.c"
+  
+# 1 "guard.h"
+ 
+ 
+int guarded; 
+ 
+# 3 "test_guard_undef.c"
+ 
+ 
+# 1 "guard.h"
+ 
+ 
+int guarded; 
+ 
+# 6 "test_guard_undef.c"
+ 
+int end; 
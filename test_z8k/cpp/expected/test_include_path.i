@@ -0,0 +1,23 @@
+# 1 "test_include_path.c"
+ 
+ 
+  
+# 1 "inc1/both.h"
+  
+int both_inc1; 
+# 5 "test_include_path.c"
+# 1 "inc2/second.h"
+  
+int second_inc2; 
+# 6 "test_include_path.c"
+# 1 "inc2/second.h"
+  
+int second_inc2; 
+# 7 "test_include_path.c"
+ 
+# 1 "inc2/second.h"
+  
+int second_inc2; 
+# 9 "test_include_path.c"
+ 
+int end; 
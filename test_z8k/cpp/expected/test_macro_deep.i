@@ -0,0 +1,8 @@
+# 1 "test_macro_deep.c"
+ 
+ 
+  
+ 
+ 
+int w = 1 { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; } { struct level *next; }; 
+int end; 
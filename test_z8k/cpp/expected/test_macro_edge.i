@@ -0,0 +1,13 @@
+# 1 "test_macro_edge.c"
+ 
+  
+ 
+ 
+ 
+ 
+int a = -- 1; 
+int d = --1; 
+int e = x <= y; 
+int abcd; 
+int g = ++h; 
+int b = x  y; 
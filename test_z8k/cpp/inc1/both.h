@@ -0,0 +1,2 @@
+/* found in inc1, ahead of the one in inc2 */
+int both_inc1;
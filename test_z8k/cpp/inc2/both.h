@@ -0,0 +1,2 @@
+/* shadowed by inc1/both.h */
+int both_inc2;
@@ -0,0 +1,2 @@
+/* in inc2 only */
+int second_inc2;
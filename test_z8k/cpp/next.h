@@ -0,0 +1,2 @@
+/* beside the test: only its own "" include finds this one */
+int top_next;
@@ -0,0 +1,24 @@
+# 1 "test_crlf.c"
+ 
+  
+int crlf1; 
+int crlf2; 
+# 1 "crlf.h"
+  
+int in_header; 
+ 
+int header_end; 
+# 6 "test_crlf.c"
+int lonecr1; 
+int lonecr2; 
+ 
+int mixed = 2; 
+# 1 "crlf.h"
+  
+int in_header; 
+ 
+int header_end; 
+# 11 "test_crlf.c"
+int cont = 1 + \ 
+  2; 
+int end; 
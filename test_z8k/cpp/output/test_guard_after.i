@@ -0,0 +1,17 @@
+# 1 "test_guard_after.c"
+  
+# 1 "after.h"
+ 
+ 
+int inside; 
+ 
+int after; 
+# 3 "test_guard_after.c"
+# 1 "after.h"
+ 
+ 
+ 
+ 
+int after; 
+# 4 "test_guard_after.c"
+int end; 
@@ -0,0 +1,24 @@
+# 1 "test_include_rel.c"
+ 
+  
+# 1 "sub/rel.h"
+  
+# 1 "sub/next.h"
+  
+int sub_next; 
+# 3 "sub/rel.h"
+int sub_rel; 
+# 4 "test_include_rel.c"
+# 1 "next.h"
+  
+int top_next; 
+# 5 "test_include_rel.c"
+# 1 "sub/rel.h"
+  
+# 1 "sub/next.h"
+  
+int sub_next; 
+# 3 "sub/rel.h"
+int sub_rel; 
+# 6 "test_include_rel.c"
+int end; 
@@ -0,0 +1,11 @@
+# 1 "test_macro_string.c"
+ 
+  
+ 
+ 
+ 
+char *m = "count is  10"; 
+char *n = ""q" is  x+1"; 
+int c = 'a'; 
+char *k = "y and z"; 
+char *s = "MSG(a, b)"; 
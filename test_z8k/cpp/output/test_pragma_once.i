@@ -0,0 +1,9 @@
+# 1 "test_pragma_once.c"
+  
+# 1 "once.h"
+ 
+int once; 
+# 3 "test_pragma_once.c"
+ 
+ 
+int end; 
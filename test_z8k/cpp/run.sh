@@ -0,0 +1,61 @@
+#!/bin/bash
+# Cpp test suite: preprocess each test with cp68 and diff against expected output
+# Usage: ./run.sh [test_name.c]
+
+SUITEDIR="$(cd "$(dirname "$0")" && pwd)"
+source "$SUITEDIR/../common.sh"
+
+mkdir -p "$SUITEDIR/output"
+
+# A test's flags, if it has any, are in <name>.flags.  A test that
+# expects cp68 to complain has its messages in expected/<name>.err.
+run_one_test() {
+    local name=$(basename "$1" .c)
+    local errors flags=""
+
+    [ -f "$SUITEDIR/$name.flags" ] && flags=$(cat "$SUITEDIR/$name.flags")
+
+    # cp68 names files in its output as given, so run it from here
+    errors=$( cd "$SUITEDIR" && "$CP68" $flags "$name.c" "output/$name.i" 2>&1 )
+    local rc=$?
+
+    if [ -f "$SUITEDIR/expected/$name.err" ]; then
+        if [ "$errors" != "$(cat "$SUITEDIR/expected/$name.err")" ]; then
+            echo "FAIL $name (cp68 said: $errors)"
+            fail=$((fail+1))
+            return
+        fi
+        rc=0
+    fi
+
+    if [ $rc -ne 0 ]; then
+        echo "FAIL $name (cp68 exit code $rc: $errors)"
+        fail=$((fail+1))
+    elif [ ! -f "$SUITEDIR/expected/$name.i" ]; then
+        echo "SKIP $name (no expected output)"
+        skip=$((skip+1))
+    else
+        local d
+        d=$(diff "$SUITEDIR/expected/$name.i" "$SUITEDIR/output/$name.i")
+        if [ -z "$d" ]; then
+            echo "PASS $name"
+            pass=$((pass+1))
+        else
+            echo "FAIL $name"
+            echo "$d" | head -20
+            fail=$((fail+1))
+        fi
+    fi
+}
+
+if [ -n "$1" ]; then
+    run_one_test "$SUITEDIR/$1"
+else
+    for t in "$SUITEDIR"/test_*.c; do
+        run_one_test "$t"
+    done
+fi
+
+echo ""
+echo "cpp: $pass passed, $fail failed, $skip skipped"
+print_summary
@@ -0,0 +1,2 @@
+/* next to the includer in sub/, not the one beside the test */
+int sub_next;
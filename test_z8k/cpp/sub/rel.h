@@ -0,0 +1,3 @@
+/* "" includes from here look in sub/ first */
+#include "next.h"
+int sub_rel;
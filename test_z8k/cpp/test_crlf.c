@@ -0,0 +1,9 @@
+/* CRLF and lone-CR line ends: each counts as one line, so the # lines
+   after the #include give the right line numbers */
+int crlf1;
+int crlf2;
+#include "crlf.h"
+int lonecr1;int lonecr2;#define TWO 2int mixed = TWO;
+#include "crlf.h"int cont = 1 + \
+  2;
+int end;
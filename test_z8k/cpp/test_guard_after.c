@@ -0,0 +1,4 @@
+/* code after the #endif: the header is read every time */
+#include "after.h"
+#include "after.h"
+int end;
@@ -0,0 +1,4 @@
+/* a guard with #else is no guard: the second include gives "again" */
+#include "else.h"
+#include "else.h"
+int end;
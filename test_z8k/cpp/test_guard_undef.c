@@ -0,0 +1,7 @@
+/* a guarded header is read once, until its guard is #undef'd */
+#include "guard.h"
+#include "guard.h"
+#undef GUARD_H
+#include "guard.h"
+#include "guard.h"
+int end;
@@ -0,0 +1,10 @@
+/* includes searched along -I inc1 -I inc2: the first directory with the
+   header wins, one only in inc2 is found there every time, and one in
+   neither is reported every time it is asked for */
+#include <both.h>
+#include <second.h>
+#include "second.h"
+#include "nowhere.h"
+#include <second.h>
+#include "nowhere.h"
+int end;
@@ -0,0 +1,6 @@
+/* a "" include looks in the directory of the file that names it: the
+   same name means sub/next.h from sub/rel.h and ./next.h from here */
+#include "sub/rel.h"
+#include "next.h"
+#include "sub/rel.h"
+int end;
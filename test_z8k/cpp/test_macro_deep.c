@@ -0,0 +1,7 @@
+/* function-like macros nested deeper than the old 2000-character push
+   back buffer held: the text after each argument waits there while the
+   argument is expanded, 90 levels of it */
+#define W(x) x { struct level *next; }
+#define T(x) W(W(W(W(W(W(W(W(W(W(x))))))))))
+int w = T(T(T(T(T(T(T(T(T(1)))))))));
+int end;
@@ -0,0 +1,12 @@
+/* an expansion is read again with the text around it, so tokens merge
+   across its edges */
+#define MINUS -
+#define LT <
+#define EMPTY
+#define ID(a) a
+int a = -MINUS 1;
+int d = MINUS-1;
+int e = x LT= y;
+int ID(ab)cd;
+int g = ID(+)+h;
+int b = x EMPTY y;
@@ -0,0 +1,10 @@
+/* arguments are substituted inside strings and character constants in
+   a macro body, as cp68 always did; other text in them is left alone */
+#define MSG(name, val) "name is val"
+#define CH(c) 'c'
+#define KEEP(x) "y and z"
+char *m = MSG(count, 10);
+char *n = MSG("q", x+1);
+int c = CH(a);
+char *k = KEEP(1);
+char *s = "MSG(a, b)";
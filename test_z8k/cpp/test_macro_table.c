@@ -0,0 +1,2126 @@
+/* more macros than the old 2048-entry table held, families of names
+   that the old character-sum hash put in one bucket, and names that
+   differ only past the old 22-character key */
+#define M0000 0
+#define M0001 1
+#define M0002 2
+#define M0003 3
+#define M0004 4
+#define M0005 5
+#define M0006 6
+#define M0007 7
+#define M0008 8
+#define M0009 9
+#define M0010 10
+#define M0011 11
+#define M0012 12
+#define M0013 13
+#define M0014 14
+#define M0015 15
+#define M0016 16
+#define M0017 17
+#define M0018 18
+#define M0019 19
+#define M0020 20
+#define M0021 21
+#define M0022 22
+#define M0023 23
+#define M0024 24
+#define M0025 25
+#define M0026 26
+#define M0027 27
+#define M0028 28
+#define M0029 29
+#define M0030 30
+#define M0031 31
+#define M0032 32
+#define M0033 33
+#define M0034 34
+#define M0035 35
+#define M0036 36
+#define M0037 37
+#define M0038 38
+#define M0039 39
+#define M0040 40
+#define M0041 41
+#define M0042 42
+#define M0043 43
+#define M0044 44
+#define M0045 45
+#define M0046 46
+#define M0047 47
+#define M0048 48
+#define M0049 49
+#define M0050 50
+#define M0051 51
+#define M0052 52
+#define M0053 53
+#define M0054 54
+#define M0055 55
+#define M0056 56
+#define M0057 57
+#define M0058 58
+#define M0059 59
+#define M0060 60
+#define M0061 61
+#define M0062 62
+#define M0063 63
+#define M0064 64
+#define M0065 65
+#define M0066 66
+#define M0067 67
+#define M0068 68
+#define M0069 69
+#define M0070 70
+#define M0071 71
+#define M0072 72
+#define M0073 73
+#define M0074 74
+#define M0075 75
+#define M0076 76
+#define M0077 77
+#define M0078 78
+#define M0079 79
+#define M0080 80
+#define M0081 81
+#define M0082 82
+#define M0083 83
+#define M0084 84
+#define M0085 85
+#define M0086 86
+#define M0087 87
+#define M0088 88
+#define M0089 89
+#define M0090 90
+#define M0091 91
+#define M0092 92
+#define M0093 93
+#define M0094 94
+#define M0095 95
+#define M0096 96
+#define M0097 97
+#define M0098 98
+#define M0099 99
+#define M0100 100
+#define M0101 101
+#define M0102 102
+#define M0103 103
+#define M0104 104
+#define M0105 105
+#define M0106 106
+#define M0107 107
+#define M0108 108
+#define M0109 109
+#define M0110 110
+#define M0111 111
+#define M0112 112
+#define M0113 113
+#define M0114 114
+#define M0115 115
+#define M0116 116
+#define M0117 117
+#define M0118 118
+#define M0119 119
+#define M0120 120
+#define M0121 121
+#define M0122 122
+#define M0123 123
+#define M0124 124
+#define M0125 125
+#define M0126 126
+#define M0127 127
+#define M0128 128
+#define M0129 129
+#define M0130 130
+#define M0131 131
+#define M0132 132
+#define M0133 133
+#define M0134 134
+#define M0135 135
+#define M0136 136
+#define M0137 137
+#define M0138 138
+#define M0139 139
+#define M0140 140
+#define M0141 141
+#define M0142 142
+#define M0143 143
+#define M0144 144
+#define M0145 145
+#define M0146 146
+#define M0147 147
+#define M0148 148
+#define M0149 149
+#define M0150 150
+#define M0151 151
+#define M0152 152
+#define M0153 153
+#define M0154 154
+#define M0155 155
+#define M0156 156
+#define M0157 157
+#define M0158 158
+#define M0159 159
+#define M0160 160
+#define M0161 161
+#define M0162 162
+#define M0163 163
+#define M0164 164
+#define M0165 165
+#define M0166 166
+#define M0167 167
+#define M0168 168
+#define M0169 169
+#define M0170 170
+#define M0171 171
+#define M0172 172
+#define M0173 173
+#define M0174 174
+#define M0175 175
+#define M0176 176
+#define M0177 177
+#define M0178 178
+#define M0179 179
+#define M0180 180
+#define M0181 181
+#define M0182 182
+#define M0183 183
+#define M0184 184
+#define M0185 185
+#define M0186 186
+#define M0187 187
+#define M0188 188
+#define M0189 189
+#define M0190 190
+#define M0191 191
+#define M0192 192
+#define M0193 193
+#define M0194 194
+#define M0195 195
+#define M0196 196
+#define M0197 197
+#define M0198 198
+#define M0199 199
+#define M0200 200
+#define M0201 201
+#define M0202 202
+#define M0203 203
+#define M0204 204
+#define M0205 205
+#define M0206 206
+#define M0207 207
+#define M0208 208
+#define M0209 209
+#define M0210 210
+#define M0211 211
+#define M0212 212
+#define M0213 213
+#define M0214 214
+#define M0215 215
+#define M0216 216
+#define M0217 217
+#define M0218 218
+#define M0219 219
+#define M0220 220
+#define M0221 221
+#define M0222 222
+#define M0223 223
+#define M0224 224
+#define M0225 225
+#define M0226 226
+#define M0227 227
+#define M0228 228
+#define M0229 229
+#define M0230 230
+#define M0231 231
+#define M0232 232
+#define M0233 233
+#define M0234 234
+#define M0235 235
+#define M0236 236
+#define M0237 237
+#define M0238 238
+#define M0239 239
+#define M0240 240
+#define M0241 241
+#define M0242 242
+#define M0243 243
+#define M0244 244
+#define M0245 245
+#define M0246 246
+#define M0247 247
+#define M0248 248
+#define M0249 249
+#define M0250 250
+#define M0251 251
+#define M0252 252
+#define M0253 253
+#define M0254 254
+#define M0255 255
+#define M0256 256
+#define M0257 257
+#define M0258 258
+#define M0259 259
+#define M0260 260
+#define M0261 261
+#define M0262 262
+#define M0263 263
+#define M0264 264
+#define M0265 265
+#define M0266 266
+#define M0267 267
+#define M0268 268
+#define M0269 269
+#define M0270 270
+#define M0271 271
+#define M0272 272
+#define M0273 273
+#define M0274 274
+#define M0275 275
+#define M0276 276
+#define M0277 277
+#define M0278 278
+#define M0279 279
+#define M0280 280
+#define M0281 281
+#define M0282 282
+#define M0283 283
+#define M0284 284
+#define M0285 285
+#define M0286 286
+#define M0287 287
+#define M0288 288
+#define M0289 289
+#define M0290 290
+#define M0291 291
+#define M0292 292
+#define M0293 293
+#define M0294 294
+#define M0295 295
+#define M0296 296
+#define M0297 297
+#define M0298 298
+#define M0299 299
+#define M0300 300
+#define M0301 301
+#define M0302 302
+#define M0303 303
+#define M0304 304
+#define M0305 305
+#define M0306 306
+#define M0307 307
+#define M0308 308
+#define M0309 309
+#define M0310 310
+#define M0311 311
+#define M0312 312
+#define M0313 313
+#define M0314 314
+#define M0315 315
+#define M0316 316
+#define M0317 317
+#define M0318 318
+#define M0319 319
+#define M0320 320
+#define M0321 321
+#define M0322 322
+#define M0323 323
+#define M0324 324
+#define M0325 325
+#define M0326 326
+#define M0327 327
+#define M0328 328
+#define M0329 329
+#define M0330 330
+#define M0331 331
+#define M0332 332
+#define M0333 333
+#define M0334 334
+#define M0335 335
+#define M0336 336
+#define M0337 337
+#define M0338 338
+#define M0339 339
+#define M0340 340
+#define M0341 341
+#define M0342 342
+#define M0343 343
+#define M0344 344
+#define M0345 345
+#define M0346 346
+#define M0347 347
+#define M0348 348
+#define M0349 349
+#define M0350 350
+#define M0351 351
+#define M0352 352
+#define M0353 353
+#define M0354 354
+#define M0355 355
+#define M0356 356
+#define M0357 357
+#define M0358 358
+#define M0359 359
+#define M0360 360
+#define M0361 361
+#define M0362 362
+#define M0363 363
+#define M0364 364
+#define M0365 365
+#define M0366 366
+#define M0367 367
+#define M0368 368
+#define M0369 369
+#define M0370 370
+#define M0371 371
+#define M0372 372
+#define M0373 373
+#define M0374 374
+#define M0375 375
+#define M0376 376
+#define M0377 377
+#define M0378 378
+#define M0379 379
+#define M0380 380
+#define M0381 381
+#define M0382 382
+#define M0383 383
+#define M0384 384
+#define M0385 385
+#define M0386 386
+#define M0387 387
+#define M0388 388
+#define M0389 389
+#define M0390 390
+#define M0391 391
+#define M0392 392
+#define M0393 393
+#define M0394 394
+#define M0395 395
+#define M0396 396
+#define M0397 397
+#define M0398 398
+#define M0399 399
+#define M0400 400
+#define M0401 401
+#define M0402 402
+#define M0403 403
+#define M0404 404
+#define M0405 405
+#define M0406 406
+#define M0407 407
+#define M0408 408
+#define M0409 409
+#define M0410 410
+#define M0411 411
+#define M0412 412
+#define M0413 413
+#define M0414 414
+#define M0415 415
+#define M0416 416
+#define M0417 417
+#define M0418 418
+#define M0419 419
+#define M0420 420
+#define M0421 421
+#define M0422 422
+#define M0423 423
+#define M0424 424
+#define M0425 425
+#define M0426 426
+#define M0427 427
+#define M0428 428
+#define M0429 429
+#define M0430 430
+#define M0431 431
+#define M0432 432
+#define M0433 433
+#define M0434 434
+#define M0435 435
+#define M0436 436
+#define M0437 437
+#define M0438 438
+#define M0439 439
+#define M0440 440
+#define M0441 441
+#define M0442 442
+#define M0443 443
+#define M0444 444
+#define M0445 445
+#define M0446 446
+#define M0447 447
+#define M0448 448
+#define M0449 449
+#define M0450 450
+#define M0451 451
+#define M0452 452
+#define M0453 453
+#define M0454 454
+#define M0455 455
+#define M0456 456
+#define M0457 457
+#define M0458 458
+#define M0459 459
+#define M0460 460
+#define M0461 461
+#define M0462 462
+#define M0463 463
+#define M0464 464
+#define M0465 465
+#define M0466 466
+#define M0467 467
+#define M0468 468
+#define M0469 469
+#define M0470 470
+#define M0471 471
+#define M0472 472
+#define M0473 473
+#define M0474 474
+#define M0475 475
+#define M0476 476
+#define M0477 477
+#define M0478 478
+#define M0479 479
+#define M0480 480
+#define M0481 481
+#define M0482 482
+#define M0483 483
+#define M0484 484
+#define M0485 485
+#define M0486 486
+#define M0487 487
+#define M0488 488
+#define M0489 489
+#define M0490 490
+#define M0491 491
+#define M0492 492
+#define M0493 493
+#define M0494 494
+#define M0495 495
+#define M0496 496
+#define M0497 497
+#define M0498 498
+#define M0499 499
+#define M0500 500
+#define M0501 501
+#define M0502 502
+#define M0503 503
+#define M0504 504
+#define M0505 505
+#define M0506 506
+#define M0507 507
+#define M0508 508
+#define M0509 509
+#define M0510 510
+#define M0511 511
+#define M0512 512
+#define M0513 513
+#define M0514 514
+#define M0515 515
+#define M0516 516
+#define M0517 517
+#define M0518 518
+#define M0519 519
+#define M0520 520
+#define M0521 521
+#define M0522 522
+#define M0523 523
+#define M0524 524
+#define M0525 525
+#define M0526 526
+#define M0527 527
+#define M0528 528
+#define M0529 529
+#define M0530 530
+#define M0531 531
+#define M0532 532
+#define M0533 533
+#define M0534 534
+#define M0535 535
+#define M0536 536
+#define M0537 537
+#define M0538 538
+#define M0539 539
+#define M0540 540
+#define M0541 541
+#define M0542 542
+#define M0543 543
+#define M0544 544
+#define M0545 545
+#define M0546 546
+#define M0547 547
+#define M0548 548
+#define M0549 549
+#define M0550 550
+#define M0551 551
+#define M0552 552
+#define M0553 553
+#define M0554 554
+#define M0555 555
+#define M0556 556
+#define M0557 557
+#define M0558 558
+#define M0559 559
+#define M0560 560
+#define M0561 561
+#define M0562 562
+#define M0563 563
+#define M0564 564
+#define M0565 565
+#define M0566 566
+#define M0567 567
+#define M0568 568
+#define M0569 569
+#define M0570 570
+#define M0571 571
+#define M0572 572
+#define M0573 573
+#define M0574 574
+#define M0575 575
+#define M0576 576
+#define M0577 577
+#define M0578 578
+#define M0579 579
+#define M0580 580
+#define M0581 581
+#define M0582 582
+#define M0583 583
+#define M0584 584
+#define M0585 585
+#define M0586 586
+#define M0587 587
+#define M0588 588
+#define M0589 589
+#define M0590 590
+#define M0591 591
+#define M0592 592
+#define M0593 593
+#define M0594 594
+#define M0595 595
+#define M0596 596
+#define M0597 597
+#define M0598 598
+#define M0599 599
+#define M0600 600
+#define M0601 601
+#define M0602 602
+#define M0603 603
+#define M0604 604
+#define M0605 605
+#define M0606 606
+#define M0607 607
+#define M0608 608
+#define M0609 609
+#define M0610 610
+#define M0611 611
+#define M0612 612
+#define M0613 613
+#define M0614 614
+#define M0615 615
+#define M0616 616
+#define M0617 617
+#define M0618 618
+#define M0619 619
+#define M0620 620
+#define M0621 621
+#define M0622 622
+#define M0623 623
+#define M0624 624
+#define M0625 625
+#define M0626 626
+#define M0627 627
+#define M0628 628
+#define M0629 629
+#define M0630 630
+#define M0631 631
+#define M0632 632
+#define M0633 633
+#define M0634 634
+#define M0635 635
+#define M0636 636
+#define M0637 637
+#define M0638 638
+#define M0639 639
+#define M0640 640
+#define M0641 641
+#define M0642 642
+#define M0643 643
+#define M0644 644
+#define M0645 645
+#define M0646 646
+#define M0647 647
+#define M0648 648
+#define M0649 649
+#define M0650 650
+#define M0651 651
+#define M0652 652
+#define M0653 653
+#define M0654 654
+#define M0655 655
+#define M0656 656
+#define M0657 657
+#define M0658 658
+#define M0659 659
+#define M0660 660
+#define M0661 661
+#define M0662 662
+#define M0663 663
+#define M0664 664
+#define M0665 665
+#define M0666 666
+#define M0667 667
+#define M0668 668
+#define M0669 669
+#define M0670 670
+#define M0671 671
+#define M0672 672
+#define M0673 673
+#define M0674 674
+#define M0675 675
+#define M0676 676
+#define M0677 677
+#define M0678 678
+#define M0679 679
+#define M0680 680
+#define M0681 681
+#define M0682 682
+#define M0683 683
+#define M0684 684
+#define M0685 685
+#define M0686 686
+#define M0687 687
+#define M0688 688
+#define M0689 689
+#define M0690 690
+#define M0691 691
+#define M0692 692
+#define M0693 693
+#define M0694 694
+#define M0695 695
+#define M0696 696
+#define M0697 697
+#define M0698 698
+#define M0699 699
+#define M0700 700
+#define M0701 701
+#define M0702 702
+#define M0703 703
+#define M0704 704
+#define M0705 705
+#define M0706 706
+#define M0707 707
+#define M0708 708
+#define M0709 709
+#define M0710 710
+#define M0711 711
+#define M0712 712
+#define M0713 713
+#define M0714 714
+#define M0715 715
+#define M0716 716
+#define M0717 717
+#define M0718 718
+#define M0719 719
+#define M0720 720
+#define M0721 721
+#define M0722 722
+#define M0723 723
+#define M0724 724
+#define M0725 725
+#define M0726 726
+#define M0727 727
+#define M0728 728
+#define M0729 729
+#define M0730 730
+#define M0731 731
+#define M0732 732
+#define M0733 733
+#define M0734 734
+#define M0735 735
+#define M0736 736
+#define M0737 737
+#define M0738 738
+#define M0739 739
+#define M0740 740
+#define M0741 741
+#define M0742 742
+#define M0743 743
+#define M0744 744
+#define M0745 745
+#define M0746 746
+#define M0747 747
+#define M0748 748
+#define M0749 749
+#define M0750 750
+#define M0751 751
+#define M0752 752
+#define M0753 753
+#define M0754 754
+#define M0755 755
+#define M0756 756
+#define M0757 757
+#define M0758 758
+#define M0759 759
+#define M0760 760
+#define M0761 761
+#define M0762 762
+#define M0763 763
+#define M0764 764
+#define M0765 765
+#define M0766 766
+#define M0767 767
+#define M0768 768
+#define M0769 769
+#define M0770 770
+#define M0771 771
+#define M0772 772
+#define M0773 773
+#define M0774 774
+#define M0775 775
+#define M0776 776
+#define M0777 777
+#define M0778 778
+#define M0779 779
+#define M0780 780
+#define M0781 781
+#define M0782 782
+#define M0783 783
+#define M0784 784
+#define M0785 785
+#define M0786 786
+#define M0787 787
+#define M0788 788
+#define M0789 789
+#define M0790 790
+#define M0791 791
+#define M0792 792
+#define M0793 793
+#define M0794 794
+#define M0795 795
+#define M0796 796
+#define M0797 797
+#define M0798 798
+#define M0799 799
+#define M0800 800
+#define M0801 801
+#define M0802 802
+#define M0803 803
+#define M0804 804
+#define M0805 805
+#define M0806 806
+#define M0807 807
+#define M0808 808
+#define M0809 809
+#define M0810 810
+#define M0811 811
+#define M0812 812
+#define M0813 813
+#define M0814 814
+#define M0815 815
+#define M0816 816
+#define M0817 817
+#define M0818 818
+#define M0819 819
+#define M0820 820
+#define M0821 821
+#define M0822 822
+#define M0823 823
+#define M0824 824
+#define M0825 825
+#define M0826 826
+#define M0827 827
+#define M0828 828
+#define M0829 829
+#define M0830 830
+#define M0831 831
+#define M0832 832
+#define M0833 833
+#define M0834 834
+#define M0835 835
+#define M0836 836
+#define M0837 837
+#define M0838 838
+#define M0839 839
+#define M0840 840
+#define M0841 841
+#define M0842 842
+#define M0843 843
+#define M0844 844
+#define M0845 845
+#define M0846 846
+#define M0847 847
+#define M0848 848
+#define M0849 849
+#define M0850 850
+#define M0851 851
+#define M0852 852
+#define M0853 853
+#define M0854 854
+#define M0855 855
+#define M0856 856
+#define M0857 857
+#define M0858 858
+#define M0859 859
+#define M0860 860
+#define M0861 861
+#define M0862 862
+#define M0863 863
+#define M0864 864
+#define M0865 865
+#define M0866 866
+#define M0867 867
+#define M0868 868
+#define M0869 869
+#define M0870 870
+#define M0871 871
+#define M0872 872
+#define M0873 873
+#define M0874 874
+#define M0875 875
+#define M0876 876
+#define M0877 877
+#define M0878 878
+#define M0879 879
+#define M0880 880
+#define M0881 881
+#define M0882 882
+#define M0883 883
+#define M0884 884
+#define M0885 885
+#define M0886 886
+#define M0887 887
+#define M0888 888
+#define M0889 889
+#define M0890 890
+#define M0891 891
+#define M0892 892
+#define M0893 893
+#define M0894 894
+#define M0895 895
+#define M0896 896
+#define M0897 897
+#define M0898 898
+#define M0899 899
+#define M0900 900
+#define M0901 901
+#define M0902 902
+#define M0903 903
+#define M0904 904
+#define M0905 905
+#define M0906 906
+#define M0907 907
+#define M0908 908
+#define M0909 909
+#define M0910 910
+#define M0911 911
+#define M0912 912
+#define M0913 913
+#define M0914 914
+#define M0915 915
+#define M0916 916
+#define M0917 917
+#define M0918 918
+#define M0919 919
+#define M0920 920
+#define M0921 921
+#define M0922 922
+#define M0923 923
+#define M0924 924
+#define M0925 925
+#define M0926 926
+#define M0927 927
+#define M0928 928
+#define M0929 929
+#define M0930 930
+#define M0931 931
+#define M0932 932
+#define M0933 933
+#define M0934 934
+#define M0935 935
+#define M0936 936
+#define M0937 937
+#define M0938 938
+#define M0939 939
+#define M0940 940
+#define M0941 941
+#define M0942 942
+#define M0943 943
+#define M0944 944
+#define M0945 945
+#define M0946 946
+#define M0947 947
+#define M0948 948
+#define M0949 949
+#define M0950 950
+#define M0951 951
+#define M0952 952
+#define M0953 953
+#define M0954 954
+#define M0955 955
+#define M0956 956
+#define M0957 957
+#define M0958 958
+#define M0959 959
+#define M0960 960
+#define M0961 961
+#define M0962 962
+#define M0963 963
+#define M0964 964
+#define M0965 965
+#define M0966 966
+#define M0967 967
+#define M0968 968
+#define M0969 969
+#define M0970 970
+#define M0971 971
+#define M0972 972
+#define M0973 973
+#define M0974 974
+#define M0975 975
+#define M0976 976
+#define M0977 977
+#define M0978 978
+#define M0979 979
+#define M0980 980
+#define M0981 981
+#define M0982 982
+#define M0983 983
+#define M0984 984
+#define M0985 985
+#define M0986 986
+#define M0987 987
+#define M0988 988
+#define M0989 989
+#define M0990 990
+#define M0991 991
+#define M0992 992
+#define M0993 993
+#define M0994 994
+#define M0995 995
+#define M0996 996
+#define M0997 997
+#define M0998 998
+#define M0999 999
+#define M1000 1000
+#define M1001 1001
+#define M1002 1002
+#define M1003 1003
+#define M1004 1004
+#define M1005 1005
+#define M1006 1006
+#define M1007 1007
+#define M1008 1008
+#define M1009 1009
+#define M1010 1010
+#define M1011 1011
+#define M1012 1012
+#define M1013 1013
+#define M1014 1014
+#define M1015 1015
+#define M1016 1016
+#define M1017 1017
+#define M1018 1018
+#define M1019 1019
+#define M1020 1020
+#define M1021 1021
+#define M1022 1022
+#define M1023 1023
+#define M1024 1024
+#define M1025 1025
+#define M1026 1026
+#define M1027 1027
+#define M1028 1028
+#define M1029 1029
+#define M1030 1030
+#define M1031 1031
+#define M1032 1032
+#define M1033 1033
+#define M1034 1034
+#define M1035 1035
+#define M1036 1036
+#define M1037 1037
+#define M1038 1038
+#define M1039 1039
+#define M1040 1040
+#define M1041 1041
+#define M1042 1042
+#define M1043 1043
+#define M1044 1044
+#define M1045 1045
+#define M1046 1046
+#define M1047 1047
+#define M1048 1048
+#define M1049 1049
+#define M1050 1050
+#define M1051 1051
+#define M1052 1052
+#define M1053 1053
+#define M1054 1054
+#define M1055 1055
+#define M1056 1056
+#define M1057 1057
+#define M1058 1058
+#define M1059 1059
+#define M1060 1060
+#define M1061 1061
+#define M1062 1062
+#define M1063 1063
+#define M1064 1064
+#define M1065 1065
+#define M1066 1066
+#define M1067 1067
+#define M1068 1068
+#define M1069 1069
+#define M1070 1070
+#define M1071 1071
+#define M1072 1072
+#define M1073 1073
+#define M1074 1074
+#define M1075 1075
+#define M1076 1076
+#define M1077 1077
+#define M1078 1078
+#define M1079 1079
+#define M1080 1080
+#define M1081 1081
+#define M1082 1082
+#define M1083 1083
+#define M1084 1084
+#define M1085 1085
+#define M1086 1086
+#define M1087 1087
+#define M1088 1088
+#define M1089 1089
+#define M1090 1090
+#define M1091 1091
+#define M1092 1092
+#define M1093 1093
+#define M1094 1094
+#define M1095 1095
+#define M1096 1096
+#define M1097 1097
+#define M1098 1098
+#define M1099 1099
+#define M1100 1100
+#define M1101 1101
+#define M1102 1102
+#define M1103 1103
+#define M1104 1104
+#define M1105 1105
+#define M1106 1106
+#define M1107 1107
+#define M1108 1108
+#define M1109 1109
+#define M1110 1110
+#define M1111 1111
+#define M1112 1112
+#define M1113 1113
+#define M1114 1114
+#define M1115 1115
+#define M1116 1116
+#define M1117 1117
+#define M1118 1118
+#define M1119 1119
+#define M1120 1120
+#define M1121 1121
+#define M1122 1122
+#define M1123 1123
+#define M1124 1124
+#define M1125 1125
+#define M1126 1126
+#define M1127 1127
+#define M1128 1128
+#define M1129 1129
+#define M1130 1130
+#define M1131 1131
+#define M1132 1132
+#define M1133 1133
+#define M1134 1134
+#define M1135 1135
+#define M1136 1136
+#define M1137 1137
+#define M1138 1138
+#define M1139 1139
+#define M1140 1140
+#define M1141 1141
+#define M1142 1142
+#define M1143 1143
+#define M1144 1144
+#define M1145 1145
+#define M1146 1146
+#define M1147 1147
+#define M1148 1148
+#define M1149 1149
+#define M1150 1150
+#define M1151 1151
+#define M1152 1152
+#define M1153 1153
+#define M1154 1154
+#define M1155 1155
+#define M1156 1156
+#define M1157 1157
+#define M1158 1158
+#define M1159 1159
+#define M1160 1160
+#define M1161 1161
+#define M1162 1162
+#define M1163 1163
+#define M1164 1164
+#define M1165 1165
+#define M1166 1166
+#define M1167 1167
+#define M1168 1168
+#define M1169 1169
+#define M1170 1170
+#define M1171 1171
+#define M1172 1172
+#define M1173 1173
+#define M1174 1174
+#define M1175 1175
+#define M1176 1176
+#define M1177 1177
+#define M1178 1178
+#define M1179 1179
+#define M1180 1180
+#define M1181 1181
+#define M1182 1182
+#define M1183 1183
+#define M1184 1184
+#define M1185 1185
+#define M1186 1186
+#define M1187 1187
+#define M1188 1188
+#define M1189 1189
+#define M1190 1190
+#define M1191 1191
+#define M1192 1192
+#define M1193 1193
+#define M1194 1194
+#define M1195 1195
+#define M1196 1196
+#define M1197 1197
+#define M1198 1198
+#define M1199 1199
+#define M1200 1200
+#define M1201 1201
+#define M1202 1202
+#define M1203 1203
+#define M1204 1204
+#define M1205 1205
+#define M1206 1206
+#define M1207 1207
+#define M1208 1208
+#define M1209 1209
+#define M1210 1210
+#define M1211 1211
+#define M1212 1212
+#define M1213 1213
+#define M1214 1214
+#define M1215 1215
+#define M1216 1216
+#define M1217 1217
+#define M1218 1218
+#define M1219 1219
+#define M1220 1220
+#define M1221 1221
+#define M1222 1222
+#define M1223 1223
+#define M1224 1224
+#define M1225 1225
+#define M1226 1226
+#define M1227 1227
+#define M1228 1228
+#define M1229 1229
+#define M1230 1230
+#define M1231 1231
+#define M1232 1232
+#define M1233 1233
+#define M1234 1234
+#define M1235 1235
+#define M1236 1236
+#define M1237 1237
+#define M1238 1238
+#define M1239 1239
+#define M1240 1240
+#define M1241 1241
+#define M1242 1242
+#define M1243 1243
+#define M1244 1244
+#define M1245 1245
+#define M1246 1246
+#define M1247 1247
+#define M1248 1248
+#define M1249 1249
+#define M1250 1250
+#define M1251 1251
+#define M1252 1252
+#define M1253 1253
+#define M1254 1254
+#define M1255 1255
+#define M1256 1256
+#define M1257 1257
+#define M1258 1258
+#define M1259 1259
+#define M1260 1260
+#define M1261 1261
+#define M1262 1262
+#define M1263 1263
+#define M1264 1264
+#define M1265 1265
+#define M1266 1266
+#define M1267 1267
+#define M1268 1268
+#define M1269 1269
+#define M1270 1270
+#define M1271 1271
+#define M1272 1272
+#define M1273 1273
+#define M1274 1274
+#define M1275 1275
+#define M1276 1276
+#define M1277 1277
+#define M1278 1278
+#define M1279 1279
+#define M1280 1280
+#define M1281 1281
+#define M1282 1282
+#define M1283 1283
+#define M1284 1284
+#define M1285 1285
+#define M1286 1286
+#define M1287 1287
+#define M1288 1288
+#define M1289 1289
+#define M1290 1290
+#define M1291 1291
+#define M1292 1292
+#define M1293 1293
+#define M1294 1294
+#define M1295 1295
+#define M1296 1296
+#define M1297 1297
+#define M1298 1298
+#define M1299 1299
+#define M1300 1300
+#define M1301 1301
+#define M1302 1302
+#define M1303 1303
+#define M1304 1304
+#define M1305 1305
+#define M1306 1306
+#define M1307 1307
+#define M1308 1308
+#define M1309 1309
+#define M1310 1310
+#define M1311 1311
+#define M1312 1312
+#define M1313 1313
+#define M1314 1314
+#define M1315 1315
+#define M1316 1316
+#define M1317 1317
+#define M1318 1318
+#define M1319 1319
+#define M1320 1320
+#define M1321 1321
+#define M1322 1322
+#define M1323 1323
+#define M1324 1324
+#define M1325 1325
+#define M1326 1326
+#define M1327 1327
+#define M1328 1328
+#define M1329 1329
+#define M1330 1330
+#define M1331 1331
+#define M1332 1332
+#define M1333 1333
+#define M1334 1334
+#define M1335 1335
+#define M1336 1336
+#define M1337 1337
+#define M1338 1338
+#define M1339 1339
+#define M1340 1340
+#define M1341 1341
+#define M1342 1342
+#define M1343 1343
+#define M1344 1344
+#define M1345 1345
+#define M1346 1346
+#define M1347 1347
+#define M1348 1348
+#define M1349 1349
+#define M1350 1350
+#define M1351 1351
+#define M1352 1352
+#define M1353 1353
+#define M1354 1354
+#define M1355 1355
+#define M1356 1356
+#define M1357 1357
+#define M1358 1358
+#define M1359 1359
+#define M1360 1360
+#define M1361 1361
+#define M1362 1362
+#define M1363 1363
+#define M1364 1364
+#define M1365 1365
+#define M1366 1366
+#define M1367 1367
+#define M1368 1368
+#define M1369 1369
+#define M1370 1370
+#define M1371 1371
+#define M1372 1372
+#define M1373 1373
+#define M1374 1374
+#define M1375 1375
+#define M1376 1376
+#define M1377 1377
+#define M1378 1378
+#define M1379 1379
+#define M1380 1380
+#define M1381 1381
+#define M1382 1382
+#define M1383 1383
+#define M1384 1384
+#define M1385 1385
+#define M1386 1386
+#define M1387 1387
+#define M1388 1388
+#define M1389 1389
+#define M1390 1390
+#define M1391 1391
+#define M1392 1392
+#define M1393 1393
+#define M1394 1394
+#define M1395 1395
+#define M1396 1396
+#define M1397 1397
+#define M1398 1398
+#define M1399 1399
+#define M1400 1400
+#define M1401 1401
+#define M1402 1402
+#define M1403 1403
+#define M1404 1404
+#define M1405 1405
+#define M1406 1406
+#define M1407 1407
+#define M1408 1408
+#define M1409 1409
+#define M1410 1410
+#define M1411 1411
+#define M1412 1412
+#define M1413 1413
+#define M1414 1414
+#define M1415 1415
+#define M1416 1416
+#define M1417 1417
+#define M1418 1418
+#define M1419 1419
+#define M1420 1420
+#define M1421 1421
+#define M1422 1422
+#define M1423 1423
+#define M1424 1424
+#define M1425 1425
+#define M1426 1426
+#define M1427 1427
+#define M1428 1428
+#define M1429 1429
+#define M1430 1430
+#define M1431 1431
+#define M1432 1432
+#define M1433 1433
+#define M1434 1434
+#define M1435 1435
+#define M1436 1436
+#define M1437 1437
+#define M1438 1438
+#define M1439 1439
+#define M1440 1440
+#define M1441 1441
+#define M1442 1442
+#define M1443 1443
+#define M1444 1444
+#define M1445 1445
+#define M1446 1446
+#define M1447 1447
+#define M1448 1448
+#define M1449 1449
+#define M1450 1450
+#define M1451 1451
+#define M1452 1452
+#define M1453 1453
+#define M1454 1454
+#define M1455 1455
+#define M1456 1456
+#define M1457 1457
+#define M1458 1458
+#define M1459 1459
+#define M1460 1460
+#define M1461 1461
+#define M1462 1462
+#define M1463 1463
+#define M1464 1464
+#define M1465 1465
+#define M1466 1466
+#define M1467 1467
+#define M1468 1468
+#define M1469 1469
+#define M1470 1470
+#define M1471 1471
+#define M1472 1472
+#define M1473 1473
+#define M1474 1474
+#define M1475 1475
+#define M1476 1476
+#define M1477 1477
+#define M1478 1478
+#define M1479 1479
+#define M1480 1480
+#define M1481 1481
+#define M1482 1482
+#define M1483 1483
+#define M1484 1484
+#define M1485 1485
+#define M1486 1486
+#define M1487 1487
+#define M1488 1488
+#define M1489 1489
+#define M1490 1490
+#define M1491 1491
+#define M1492 1492
+#define M1493 1493
+#define M1494 1494
+#define M1495 1495
+#define M1496 1496
+#define M1497 1497
+#define M1498 1498
+#define M1499 1499
+#define M1500 1500
+#define M1501 1501
+#define M1502 1502
+#define M1503 1503
+#define M1504 1504
+#define M1505 1505
+#define M1506 1506
+#define M1507 1507
+#define M1508 1508
+#define M1509 1509
+#define M1510 1510
+#define M1511 1511
+#define M1512 1512
+#define M1513 1513
+#define M1514 1514
+#define M1515 1515
+#define M1516 1516
+#define M1517 1517
+#define M1518 1518
+#define M1519 1519
+#define M1520 1520
+#define M1521 1521
+#define M1522 1522
+#define M1523 1523
+#define M1524 1524
+#define M1525 1525
+#define M1526 1526
+#define M1527 1527
+#define M1528 1528
+#define M1529 1529
+#define M1530 1530
+#define M1531 1531
+#define M1532 1532
+#define M1533 1533
+#define M1534 1534
+#define M1535 1535
+#define M1536 1536
+#define M1537 1537
+#define M1538 1538
+#define M1539 1539
+#define M1540 1540
+#define M1541 1541
+#define M1542 1542
+#define M1543 1543
+#define M1544 1544
+#define M1545 1545
+#define M1546 1546
+#define M1547 1547
+#define M1548 1548
+#define M1549 1549
+#define M1550 1550
+#define M1551 1551
+#define M1552 1552
+#define M1553 1553
+#define M1554 1554
+#define M1555 1555
+#define M1556 1556
+#define M1557 1557
+#define M1558 1558
+#define M1559 1559
+#define M1560 1560
+#define M1561 1561
+#define M1562 1562
+#define M1563 1563
+#define M1564 1564
+#define M1565 1565
+#define M1566 1566
+#define M1567 1567
+#define M1568 1568
+#define M1569 1569
+#define M1570 1570
+#define M1571 1571
+#define M1572 1572
+#define M1573 1573
+#define M1574 1574
+#define M1575 1575
+#define M1576 1576
+#define M1577 1577
+#define M1578 1578
+#define M1579 1579
+#define M1580 1580
+#define M1581 1581
+#define M1582 1582
+#define M1583 1583
+#define M1584 1584
+#define M1585 1585
+#define M1586 1586
+#define M1587 1587
+#define M1588 1588
+#define M1589 1589
+#define M1590 1590
+#define M1591 1591
+#define M1592 1592
+#define M1593 1593
+#define M1594 1594
+#define M1595 1595
+#define M1596 1596
+#define M1597 1597
+#define M1598 1598
+#define M1599 1599
+#define M1600 1600
+#define M1601 1601
+#define M1602 1602
+#define M1603 1603
+#define M1604 1604
+#define M1605 1605
+#define M1606 1606
+#define M1607 1607
+#define M1608 1608
+#define M1609 1609
+#define M1610 1610
+#define M1611 1611
+#define M1612 1612
+#define M1613 1613
+#define M1614 1614
+#define M1615 1615
+#define M1616 1616
+#define M1617 1617
+#define M1618 1618
+#define M1619 1619
+#define M1620 1620
+#define M1621 1621
+#define M1622 1622
+#define M1623 1623
+#define M1624 1624
+#define M1625 1625
+#define M1626 1626
+#define M1627 1627
+#define M1628 1628
+#define M1629 1629
+#define M1630 1630
+#define M1631 1631
+#define M1632 1632
+#define M1633 1633
+#define M1634 1634
+#define M1635 1635
+#define M1636 1636
+#define M1637 1637
+#define M1638 1638
+#define M1639 1639
+#define M1640 1640
+#define M1641 1641
+#define M1642 1642
+#define M1643 1643
+#define M1644 1644
+#define M1645 1645
+#define M1646 1646
+#define M1647 1647
+#define M1648 1648
+#define M1649 1649
+#define M1650 1650
+#define M1651 1651
+#define M1652 1652
+#define M1653 1653
+#define M1654 1654
+#define M1655 1655
+#define M1656 1656
+#define M1657 1657
+#define M1658 1658
+#define M1659 1659
+#define M1660 1660
+#define M1661 1661
+#define M1662 1662
+#define M1663 1663
+#define M1664 1664
+#define M1665 1665
+#define M1666 1666
+#define M1667 1667
+#define M1668 1668
+#define M1669 1669
+#define M1670 1670
+#define M1671 1671
+#define M1672 1672
+#define M1673 1673
+#define M1674 1674
+#define M1675 1675
+#define M1676 1676
+#define M1677 1677
+#define M1678 1678
+#define M1679 1679
+#define M1680 1680
+#define M1681 1681
+#define M1682 1682
+#define M1683 1683
+#define M1684 1684
+#define M1685 1685
+#define M1686 1686
+#define M1687 1687
+#define M1688 1688
+#define M1689 1689
+#define M1690 1690
+#define M1691 1691
+#define M1692 1692
+#define M1693 1693
+#define M1694 1694
+#define M1695 1695
+#define M1696 1696
+#define M1697 1697
+#define M1698 1698
+#define M1699 1699
+#define M1700 1700
+#define M1701 1701
+#define M1702 1702
+#define M1703 1703
+#define M1704 1704
+#define M1705 1705
+#define M1706 1706
+#define M1707 1707
+#define M1708 1708
+#define M1709 1709
+#define M1710 1710
+#define M1711 1711
+#define M1712 1712
+#define M1713 1713
+#define M1714 1714
+#define M1715 1715
+#define M1716 1716
+#define M1717 1717
+#define M1718 1718
+#define M1719 1719
+#define M1720 1720
+#define M1721 1721
+#define M1722 1722
+#define M1723 1723
+#define M1724 1724
+#define M1725 1725
+#define M1726 1726
+#define M1727 1727
+#define M1728 1728
+#define M1729 1729
+#define M1730 1730
+#define M1731 1731
+#define M1732 1732
+#define M1733 1733
+#define M1734 1734
+#define M1735 1735
+#define M1736 1736
+#define M1737 1737
+#define M1738 1738
+#define M1739 1739
+#define M1740 1740
+#define M1741 1741
+#define M1742 1742
+#define M1743 1743
+#define M1744 1744
+#define M1745 1745
+#define M1746 1746
+#define M1747 1747
+#define M1748 1748
+#define M1749 1749
+#define M1750 1750
+#define M1751 1751
+#define M1752 1752
+#define M1753 1753
+#define M1754 1754
+#define M1755 1755
+#define M1756 1756
+#define M1757 1757
+#define M1758 1758
+#define M1759 1759
+#define M1760 1760
+#define M1761 1761
+#define M1762 1762
+#define M1763 1763
+#define M1764 1764
+#define M1765 1765
+#define M1766 1766
+#define M1767 1767
+#define M1768 1768
+#define M1769 1769
+#define M1770 1770
+#define M1771 1771
+#define M1772 1772
+#define M1773 1773
+#define M1774 1774
+#define M1775 1775
+#define M1776 1776
+#define M1777 1777
+#define M1778 1778
+#define M1779 1779
+#define M1780 1780
+#define M1781 1781
+#define M1782 1782
+#define M1783 1783
+#define M1784 1784
+#define M1785 1785
+#define M1786 1786
+#define M1787 1787
+#define M1788 1788
+#define M1789 1789
+#define M1790 1790
+#define M1791 1791
+#define M1792 1792
+#define M1793 1793
+#define M1794 1794
+#define M1795 1795
+#define M1796 1796
+#define M1797 1797
+#define M1798 1798
+#define M1799 1799
+#define M1800 1800
+#define M1801 1801
+#define M1802 1802
+#define M1803 1803
+#define M1804 1804
+#define M1805 1805
+#define M1806 1806
+#define M1807 1807
+#define M1808 1808
+#define M1809 1809
+#define M1810 1810
+#define M1811 1811
+#define M1812 1812
+#define M1813 1813
+#define M1814 1814
+#define M1815 1815
+#define M1816 1816
+#define M1817 1817
+#define M1818 1818
+#define M1819 1819
+#define M1820 1820
+#define M1821 1821
+#define M1822 1822
+#define M1823 1823
+#define M1824 1824
+#define M1825 1825
+#define M1826 1826
+#define M1827 1827
+#define M1828 1828
+#define M1829 1829
+#define M1830 1830
+#define M1831 1831
+#define M1832 1832
+#define M1833 1833
+#define M1834 1834
+#define M1835 1835
+#define M1836 1836
+#define M1837 1837
+#define M1838 1838
+#define M1839 1839
+#define M1840 1840
+#define M1841 1841
+#define M1842 1842
+#define M1843 1843
+#define M1844 1844
+#define M1845 1845
+#define M1846 1846
+#define M1847 1847
+#define M1848 1848
+#define M1849 1849
+#define M1850 1850
+#define M1851 1851
+#define M1852 1852
+#define M1853 1853
+#define M1854 1854
+#define M1855 1855
+#define M1856 1856
+#define M1857 1857
+#define M1858 1858
+#define M1859 1859
+#define M1860 1860
+#define M1861 1861
+#define M1862 1862
+#define M1863 1863
+#define M1864 1864
+#define M1865 1865
+#define M1866 1866
+#define M1867 1867
+#define M1868 1868
+#define M1869 1869
+#define M1870 1870
+#define M1871 1871
+#define M1872 1872
+#define M1873 1873
+#define M1874 1874
+#define M1875 1875
+#define M1876 1876
+#define M1877 1877
+#define M1878 1878
+#define M1879 1879
+#define M1880 1880
+#define M1881 1881
+#define M1882 1882
+#define M1883 1883
+#define M1884 1884
+#define M1885 1885
+#define M1886 1886
+#define M1887 1887
+#define M1888 1888
+#define M1889 1889
+#define M1890 1890
+#define M1891 1891
+#define M1892 1892
+#define M1893 1893
+#define M1894 1894
+#define M1895 1895
+#define M1896 1896
+#define M1897 1897
+#define M1898 1898
+#define M1899 1899
+#define M1900 1900
+#define M1901 1901
+#define M1902 1902
+#define M1903 1903
+#define M1904 1904
+#define M1905 1905
+#define M1906 1906
+#define M1907 1907
+#define M1908 1908
+#define M1909 1909
+#define M1910 1910
+#define M1911 1911
+#define M1912 1912
+#define M1913 1913
+#define M1914 1914
+#define M1915 1915
+#define M1916 1916
+#define M1917 1917
+#define M1918 1918
+#define M1919 1919
+#define M1920 1920
+#define M1921 1921
+#define M1922 1922
+#define M1923 1923
+#define M1924 1924
+#define M1925 1925
+#define M1926 1926
+#define M1927 1927
+#define M1928 1928
+#define M1929 1929
+#define M1930 1930
+#define M1931 1931
+#define M1932 1932
+#define M1933 1933
+#define M1934 1934
+#define M1935 1935
+#define M1936 1936
+#define M1937 1937
+#define M1938 1938
+#define M1939 1939
+#define M1940 1940
+#define M1941 1941
+#define M1942 1942
+#define M1943 1943
+#define M1944 1944
+#define M1945 1945
+#define M1946 1946
+#define M1947 1947
+#define M1948 1948
+#define M1949 1949
+#define M1950 1950
+#define M1951 1951
+#define M1952 1952
+#define M1953 1953
+#define M1954 1954
+#define M1955 1955
+#define M1956 1956
+#define M1957 1957
+#define M1958 1958
+#define M1959 1959
+#define M1960 1960
+#define M1961 1961
+#define M1962 1962
+#define M1963 1963
+#define M1964 1964
+#define M1965 1965
+#define M1966 1966
+#define M1967 1967
+#define M1968 1968
+#define M1969 1969
+#define M1970 1970
+#define M1971 1971
+#define M1972 1972
+#define M1973 1973
+#define M1974 1974
+#define M1975 1975
+#define M1976 1976
+#define M1977 1977
+#define M1978 1978
+#define M1979 1979
+#define M1980 1980
+#define M1981 1981
+#define M1982 1982
+#define M1983 1983
+#define M1984 1984
+#define M1985 1985
+#define M1986 1986
+#define M1987 1987
+#define M1988 1988
+#define M1989 1989
+#define M1990 1990
+#define M1991 1991
+#define M1992 1992
+#define M1993 1993
+#define M1994 1994
+#define M1995 1995
+#define M1996 1996
+#define M1997 1997
+#define M1998 1998
+#define M1999 1999
+#define M2000 2000
+#define M2001 2001
+#define M2002 2002
+#define M2003 2003
+#define M2004 2004
+#define M2005 2005
+#define M2006 2006
+#define M2007 2007
+#define M2008 2008
+#define M2009 2009
+#define M2010 2010
+#define M2011 2011
+#define M2012 2012
+#define M2013 2013
+#define M2014 2014
+#define M2015 2015
+#define M2016 2016
+#define M2017 2017
+#define M2018 2018
+#define M2019 2019
+#define M2020 2020
+#define M2021 2021
+#define M2022 2022
+#define M2023 2023
+#define M2024 2024
+#define M2025 2025
+#define M2026 2026
+#define M2027 2027
+#define M2028 2028
+#define M2029 2029
+#define M2030 2030
+#define M2031 2031
+#define M2032 2032
+#define M2033 2033
+#define M2034 2034
+#define M2035 2035
+#define M2036 2036
+#define M2037 2037
+#define M2038 2038
+#define M2039 2039
+#define M2040 2040
+#define M2041 2041
+#define M2042 2042
+#define M2043 2043
+#define M2044 2044
+#define M2045 2045
+#define M2046 2046
+#define M2047 2047
+#define M2048 2048
+#define M2049 2049
+#define M2050 2050
+#define M2051 2051
+#define M2052 2052
+#define M2053 2053
+#define M2054 2054
+#define M2055 2055
+#define M2056 2056
+#define M2057 2057
+#define M2058 2058
+#define M2059 2059
+#define M2060 2060
+#define M2061 2061
+#define M2062 2062
+#define M2063 2063
+#define M2064 2064
+#define M2065 2065
+#define M2066 2066
+#define M2067 2067
+#define M2068 2068
+#define M2069 2069
+#define M2070 2070
+#define M2071 2071
+#define M2072 2072
+#define M2073 2073
+#define M2074 2074
+#define M2075 2075
+#define M2076 2076
+#define M2077 2077
+#define M2078 2078
+#define M2079 2079
+#define M2080 2080
+#define M2081 2081
+#define M2082 2082
+#define M2083 2083
+#define M2084 2084
+#define M2085 2085
+#define M2086 2086
+#define M2087 2087
+#define M2088 2088
+#define M2089 2089
+#define M2090 2090
+#define M2091 2091
+#define M2092 2092
+#define M2093 2093
+#define M2094 2094
+#define M2095 2095
+#define M2096 2096
+#define M2097 2097
+#define M2098 2098
+#define M2099 2099
+int first = M0000, last = M2099, mid = M1024;
+#define AB 1
+#define BA 2
+#define ABC 3
+#define CBA 4
+#define BCA 5
+int ana[] = { AB, BA, ABC, CBA, BCA, CAB };
+#define REG_A0 0
+#define REG_A1 1
+#define REG_A2 2
+#define REG_A3 3
+#define REG_A4 4
+#define REG_A5 5
+#define REG_A6 6
+#define REG_A7 7
+#define REG_A8 8
+#define REG_A9 9
+int reg[] = { REG_A0, REG_A1, REG_A2, REG_A3, REG_A4, REG_A5, REG_A6, REG_A7, REG_A8, REG_A9 };
+#define configuration_register_low 0x10
+#define configuration_register_high 0x20
+int lo = configuration_register_low, hi = configuration_register_high;
+#undef configuration_register_low
+int lo2 = configuration_register_low, hi2 = configuration_register_high;
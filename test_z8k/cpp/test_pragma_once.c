@@ -0,0 +1,5 @@
+/* #pragma once: the header is read only the first time */
+#include "once.h"
+#include "once.h"
+#include "once.h"
+int end;
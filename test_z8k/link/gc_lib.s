@@ -0,0 +1,24 @@
+; c1z8k -F output in miniature: a .common ahead of the functions, each
+; in a section of its own.  xcon writes the two bytes of the .common
+; into the file, and -g has to step over them to find the relocation
+; items
+	.global	_g
+_g	.common
+	.block	2
+	.global	_f1
+__text01	.sect
+_f1:
+	call	_f2
+	inc	r0,#1
+	ret
+	.global	_dead
+__text02	.sect
+_dead:
+	call	_f1
+	ret
+	.global	_f2
+__text03	.sect
+_f2:
+	ld	r0,#7
+	ret
+	.end
@@ -0,0 +1,14 @@
+; gc_lib.s as -g should leave it: nothing refers to _dead or to the
+; .common, so both go
+	.global	_f1
+__text01	.sect
+_f1:
+	call	_f2
+	inc	r0,#1
+	ret
+	.global	_f2
+__text03	.sect
+_f2:
+	ld	r0,#7
+	ret
+	.end
@@ -0,0 +1,7 @@
+; -g: the first module is where the load starts, so it stays in
+	.global	_f1
+__text	.sect
+_main:
+	call	_f1
+	ret
+	.end
@@ -0,0 +1,8 @@
+	.global	_ext
+__text01	.sect
+	.repeat 100
+	.repeat 250
+	.word	_ext
+	.endr
+	.endr
+	.end
@@ -0,0 +1,20 @@
+	.global	_ext
+__text01	.sect
+	.repeat 100
+	.repeat 250
+	.word	_ext
+	.endr
+	.endr
+__text02	.sect
+	.repeat 100
+	.repeat 250
+	.word	_ext
+	.endr
+	.endr
+__text03	.sect
+	.repeat 100
+	.repeat 250
+	.word	_ext
+	.endr
+	.endr
+	.end
@@ -0,0 +1,35 @@
+	.global _add
+__text	.sect
+_add:
+
+	push @R15,R14
+	ld R14,R15
+
+; line 4
+	ld R0,4(R14)
+	add R0,6(R14)
+	jp L1
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+
+; line 9
+	.global _add
+	push @R15,#20
+	push @R15,#10
+	call _add
+	inc R15,#4
+	jp L2
+L2:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
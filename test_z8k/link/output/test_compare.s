@@ -0,0 +1,50 @@
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+	add R15,#-2
+; line 4
+	clr -2(R14)
+; line 5
+; line 6
+; line 6
+	ld R0,-2(R14)
+	add R0,#1
+	ld -2(R14),R0
+L2:
+
+; line 7
+; line 8
+; line 8
+	ld R0,-2(R14)
+	add R0,#1
+	ld -2(R14),R0
+L3:
+
+; line 9
+; line 10
+; line 10
+	ld R0,-2(R14)
+	add R0,#1
+	ld -2(R14),R0
+L4:
+
+; line 11
+; line 12
+; line 12
+	ld R0,-2(R14)
+	add R0,#1
+	ld -2(R14),R0
+L5:
+
+; line 13
+	ld R0,-2(R14)
+	jp L1
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
@@ -0,0 +1,21 @@
+	.global _g
+_g	.common
+	.block 2
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+
+; line 5
+	ld _g,#99
+; line 6
+	ld R0,_g
+	jp L1
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
@@ -0,0 +1,26 @@
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+
+; line 3
+; line 4
+; line 4
+	ld R0,#10
+	jp L1
+	jp L3
+L2:
+
+; line 5
+; line 6
+	ld R0,#20
+	jp L1
+L3:
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
@@ -0,0 +1,21 @@
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+	add R15,#-4
+; line 5
+	ld -2(R14),#5
+; line 6
+	ld -4(R14),#7
+; line 7
+	ld R0,-2(R14)
+	add R0,-4(R14)
+	jp L1
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
@@ -0,0 +1,39 @@
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+	add R15,#-4
+; line 5
+	clr -2(R14)
+; line 6
+	ld -4(R14),#1
+; line 7
+	jp L4
+L3:
+
+; line 8
+	ld R0,-2(R14)
+	add R0,-4(R14)
+	ld -2(R14),R0
+; line 9
+	ld R0,-4(R14)
+	add R0,#1
+	ld -4(R14),R0
+L4:
+
+; line 10
+	cp -4(R14),#5
+	jr le, L3
+L2:
+
+; line 11
+	ld R0,-2(R14)
+	jp L1
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
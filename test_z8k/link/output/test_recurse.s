@@ -0,0 +1,52 @@
+	.global _fact
+__text	.sect
+_fact:
+
+	push @R15,R14
+	ld R14,R15
+	add R15,#-2
+; line 5
+; line 6
+	cp 4(R14),#1
+	jr gt, L2
+; line 6
+	ld R0,#1
+	jp L1
+L2:
+
+; line 7
+	ld R0,4(R14)
+	sub R0,#1
+	ld -2(R14),R0
+; line 8
+	.global _fact
+	push @R15,-2(R14)
+	call _fact
+	inc R15,#2
+	ld R1,R0
+	mult RR0,4(R14)
+	ld R0,R1
+	jp L1
+L1:
+	ld R15,R14
+	pop R14,@R15
+	ret
+	.global _main
+__text	.sect
+_main:
+
+	push @R15,R14
+	ld R14,R15
+
+; line 13
+	.global _fact
+	push @R15,#5
+	call _fact
+	inc R15,#2
+	jp L3
+L3:
+	ld R15,R14
+	pop R14,@R15
+	ret
+__data	.sect
+	.end
@@ -0,0 +1,44 @@
+; relax_main.s and relax_lib.s in one module, relaxed by hand
+	.global _a
+	.global _b
+	.global _c
+	.global _cnt
+__text	.sect
+_a:
+	ld r1,#3
+loop:
+	calr _b
+	ldr r2,mval
+	ldar r3,mval
+	djnz r1,loop
+	jr z,done
+	calr far
+	jp nz,far
+	jr loop
+done:
+	ld r4,#_cnt
+	ld r5,#_b
+	ld r6,#far
+	ret
+mval:	.word 1
+	.block 300
+far:
+	calr loop
+	jr z,_c
+	ret
+_b:
+	ldr r0,bval
+	jr _c
+	ld r0,#1
+_c:
+	ret
+bval:	.word 9
+__data	.sect
+ptrs:	.word _a
+	.word _b
+	.word _c
+	.word far
+	.word mval
+_cnt:	.word _b
+	.word bval
+	.end
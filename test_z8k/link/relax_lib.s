@@ -0,0 +1,16 @@
+; second module for relax_main.s
+	.global _b
+	.global _c
+	.global _cnt
+__text	.sect
+_b:
+	ldr r0,bval
+	jp _c
+	ld r0,#1
+_c:
+	ret
+bval:	.word 9
+__data	.sect
+_cnt:	.word _b
+	.word bval
+	.end
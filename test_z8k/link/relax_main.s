@@ -0,0 +1,36 @@
+; linked with relax_lib.s under -b, must give the same image as
+; relax_hand.s, the same code with the jumps relaxed by hand
+	.global _a
+	.global _b
+	.global _c
+	.global _cnt
+__text	.sect
+_a:
+	ld r1,#3
+loop:
+	call _b
+	ldr r2,mval
+	ldar r3,mval
+	djnz r1,loop
+	jp z,done
+	call far
+	jp nz,far
+	jr loop
+done:
+	ld r4,#_cnt
+	ld r5,#_b
+	ld r6,#far
+	ret
+mval:	.word 1
+	.block 300
+far:
+	calr loop
+	jp z,_c
+	ret
+__data	.sect
+ptrs:	.word _a
+	.word _b
+	.word _c
+	.word far
+	.word mval
+	.end
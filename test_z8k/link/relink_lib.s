@@ -0,0 +1,10 @@
+; first version of the module relink_main.s calls
+	.global _f
+	.global _v
+__text	.sect
+_f:
+	ld r0,#1
+	ret
+__data	.sect
+_v:	.word 5
+	.end
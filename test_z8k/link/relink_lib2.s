@@ -0,0 +1,10 @@
+; relink_lib.s with its code and data changed, but not its layout
+	.global _f
+	.global _v
+__text	.sect
+_f:
+	ld r0,#2
+	ret
+__data	.sect
+_v:	.word 6
+	.end
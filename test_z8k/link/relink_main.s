@@ -0,0 +1,13 @@
+; linked with relink_lib.s, then relinked with -k after relink_lib.s is
+; replaced by relink_lib2.s
+	.global _main
+	.global _f
+	.global _v
+__text	.sect
+_main:
+	call _f
+	ld r1,_v
+	ret
+__data	.sect
+	.word _f
+	.end
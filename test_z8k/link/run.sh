@@ -0,0 +1,273 @@
+#!/bin/bash
+# Link test suite: assemble small hand-written modules, link them with
+# ld8k and check the output against an independent result.
+
+SUITEDIR="$(cd "$(dirname "$0")" && pwd)"
+source "$SUITEDIR/../common.sh"
+
+OUT="$SUITEDIR/output"
+mkdir -p "$OUT"
+
+# asm_xout <name>
+#   Assembles link/<name>.s and converts it to output/<name>.out.
+asm_xout() {
+    assemble "$SUITEDIR/$1.s" "$OUT/$1.obj"
+    obj_to_xout "$OUT/$1.obj" "$OUT/$1.out" >/dev/null
+    [ -f "$OUT/$1.out" ]
+}
+
+# check <name> <command...>
+#   Counts a PASS or FAIL for one case from the command's exit status.
+check() {
+    local name="$1"
+    shift
+    if "$@"; then
+        echo "PASS $name"
+        pass=$((pass+1))
+    else
+        echo "FAIL $name"
+        fail=$((fail+1))
+    fi
+}
+
+# -b: segments after the relaxed jumps start where the map says
+if asm_xout segpos_lib && asm_xout segpos_main; then
+    check relax_segpos same_bin "$OUT/segpos.bin" -b -- \
+        "$OUT/segpos_lib.out" "$OUT/segpos_main.out"
+else
+    echo "FAIL relax_segpos (assembly failed)"
+    fail=$((fail+1))
+fi
+
+# -b: jp/call become jr/calr, and every displacement, address and data
+# pointer follows them, the same as linking the code relaxed by hand
+relax_image() {
+    "$LD8K" -b -o "$OUT/relax.out" "$OUT/relax_main.out" "$OUT/relax_lib.out" \
+        >/dev/null 2>&1 &&
+    "$LD8K" -o "$OUT/relax_hand.x.out" "$OUT/relax_hand.out" >/dev/null 2>&1 &&
+    xout_to_bin "$OUT/relax.out" "$OUT/relax.bin" >/dev/null &&
+    xout_to_bin "$OUT/relax_hand.x.out" "$OUT/relax_hand.bin" >/dev/null &&
+    cmp -s "$OUT/relax.bin" "$OUT/relax_hand.bin"
+}
+if asm_xout relax_lib && asm_xout relax_main && asm_xout relax_hand; then
+    check relax_image relax_image
+    check relax_image_bin same_bin "$OUT/relax_b.bin" -b -- \
+        "$OUT/relax_main.out" "$OUT/relax_lib.out"
+else
+    echo "FAIL relax_image (assembly failed)"
+    fail=$((fail+1))
+fi
+
+# -k: relinking after one module's code changes gives what a full
+# link does, and takes the relink path rather than falling back.  The
+# unchanged module gets a wrong segment length behind the same size and
+# time stamp, so the relink only matches if it leaves that module unread.
+relink() {
+    cp "$OUT/relink_main.out" "$OUT/k_main.out"
+    cp "$OUT/relink_lib.out" "$OUT/k_lib.out"
+    touch -d 2000-01-01 "$OUT/k_main.out" "$OUT/k_lib.out"
+    rm -f "$OUT/k.out" "$OUT/k.out.lks"
+    "$LD8K" -k -o "$OUT/k.out" "$OUT/k_main.out" "$OUT/k_lib.out" \
+        >/dev/null 2>&1 || return 1
+    python3 -c '
+import sys
+b = bytearray(open(sys.argv[1], "rb").read())
+b[19] += 2
+open(sys.argv[1], "r+b").write(b)' "$OUT/k_main.out" || return 1
+    touch -d 2000-01-01 "$OUT/k_main.out"
+    cp "$OUT/relink_lib2.out" "$OUT/k_lib.out"
+    "$LD8K" -k --stats=json -o "$OUT/k.out" "$OUT/k_main.out" \
+        "$OUT/k_lib.out" 2>/dev/null | grep -q '"relinked": true' || return 1
+    "$LD8K" -o "$OUT/k_full.out" "$OUT/relink_main.out" "$OUT/k_lib.out" \
+        >/dev/null 2>&1 &&
+    cmp -s "$OUT/k.out" "$OUT/k_full.out"
+}
+if asm_xout relink_main && asm_xout relink_lib && asm_xout relink_lib2; then
+    check relink relink
+else
+    echo "FAIL relink (assembly failed)"
+    fail=$((fail+1))
+fi
+
+# -g: a module with a .common ahead of its sections keeps its live code,
+# the same as linking it with the dead section taken out by hand; and
+# one whose segment lengths do not add up to x_init is refused
+gc_common() {
+    "$LD8K" -g -o "$OUT/gc.out" "$OUT/gc_main.out" "$OUT/gc_lib.out" \
+        >/dev/null 2>&1 &&
+    "$LD8K" -o "$OUT/gc_live.x.out" "$OUT/gc_main.out" "$OUT/gc_live.out" \
+        >/dev/null 2>&1 &&
+    xout_to_bin "$OUT/gc.out" "$OUT/gc.bin" >/dev/null &&
+    xout_to_bin "$OUT/gc_live.x.out" "$OUT/gc_live.bin" >/dev/null &&
+    cmp -s "$OUT/gc.bin" "$OUT/gc_live.bin"
+}
+gc_badinit() {
+    python3 -c '
+import sys
+b = bytearray(open(sys.argv[1], "rb").read())
+b[0x17] += 2
+open(sys.argv[2], "wb").write(b)' "$OUT/gc_lib.out" "$OUT/gc_bad.out" &&
+    ! "$LD8K" -g -o "$OUT/gc_bad.x.out" "$OUT/gc_main.out" "$OUT/gc_bad.out" \
+        >/dev/null 2>&1
+}
+if asm_xout gc_main && asm_xout gc_lib && asm_xout gc_live; then
+    check gc_common gc_common
+    check gc_badinit gc_badinit
+else
+    echo "FAIL gc_common (assembly failed)"
+    fail=$((fail+1))
+fi
+
+# -j: the threads only share out the modules, so -j 4 writes what -j 1
+# does, plain, with -r and with -b
+jobs_same() {
+    local mods=("$OUT/relax_main.out" "$OUT/relax_lib.out"
+        "$OUT/relink_main.out" "$OUT/relink_lib.out"
+        "$OUT/gc_main.out" "$OUT/gc_lib.out")
+    "$LD8K" "$@" -j 1 -o "$OUT/j1.out" "${mods[@]}" >/dev/null 2>&1 &&
+    "$LD8K" "$@" -j 4 -o "$OUT/j4.out" "${mods[@]}" >/dev/null 2>&1 &&
+    cmp -s "$OUT/j1.out" "$OUT/j4.out"
+}
+if [ -f "$OUT/relax_lib.out" ] && [ -f "$OUT/relink_lib.out" ] &&
+        [ -f "$OUT/gc_lib.out" ]; then
+    check jobs_same jobs_same
+    check jobs_same_r jobs_same -r
+    check jobs_same_b jobs_same -b
+else
+    echo "FAIL jobs_same (assembly failed)"
+    fail=$((fail+1))
+fi
+
+# a relocation item for a segment the module does not have is an error
+reloc_badsg() {
+    python3 -c '
+import sys
+b = bytearray(open(sys.argv[1], "rb").read())
+init = int.from_bytes(b[4:8], "big")
+b[16 + 4 * (b[2] << 8 | b[3]) + init] = 9
+open(sys.argv[2], "wb").write(b)' "$OUT/relink_main.out" "$OUT/badsg.out" &&
+    ! "$LD8K" -o "$OUT/badsg.x.out" "$OUT/badsg.out" "$OUT/relink_lib.out" \
+        >/dev/null 2>&1
+}
+check reloc_badsg reloc_badsg
+
+# ar8k r: the __.SYMDEF index it writes picks the same members as a
+# search of the archive without one, and t and x pass over the index
+archive_index() {
+    rm -f "$OUT/lib.a"
+    "$AR8K" r "$OUT/lib.a" "$OUT/relax_lib.out" "$OUT/gc_lib.out" \
+        "$OUT/relink_lib.out" >/dev/null 2>&1 || return 1
+    python3 -c '
+import sys
+b = open(sys.argv[1], "rb").read()
+assert b[2:11] == b"__.SYMDEF"
+size = int.from_bytes(b[24:28], "big")
+open(sys.argv[2], "wb").write(b[:2] + b[28 + size + (size & 1):])' \
+        "$OUT/lib.a" "$OUT/lib_noidx.a" || return 1
+    "$LD8K" -o "$OUT/ar.out" "$OUT/gc_main.out" "$OUT/relink_main.out" \
+        "$OUT/lib.a" >/dev/null 2>&1 &&
+    "$LD8K" -o "$OUT/ar_noidx.out" "$OUT/gc_main.out" "$OUT/relink_main.out" \
+        "$OUT/lib_noidx.a" >/dev/null 2>&1 &&
+    cmp -s "$OUT/ar.out" "$OUT/ar_noidx.out"
+}
+archive_list() {
+    local dir
+    [ "$("$AR8K" t "$OUT/lib.a" | sed 's/ *$//')" = "$(printf '%s\n' relax_lib.out \
+        gc_lib.out relink_lib.out)" ] || return 1
+    dir=$(mktemp -d) || return 1
+    ( cd "$dir" && "$AR8K" x "$OUT/lib.a" >/dev/null 2>&1 )
+    [ "$(ls "$dir")" = "$(printf '%s\n' gc_lib.out relax_lib.out \
+        relink_lib.out)" ] &&
+    cmp -s "$dir/relink_lib.out" "$OUT/relink_lib.out"
+    local rc=$?
+    rm -rf "$dir"
+    return $rc
+}
+if [ -f "$OUT/relax_lib.out" ] && [ -f "$OUT/relink_lib.out" ] &&
+        [ -f "$OUT/gc_lib.out" ]; then
+    check archive_index archive_index
+    check archive_list archive_list
+else
+    echo "FAIL archive_index (assembly failed)"
+    fail=$((fail+1))
+fi
+
+# --stats=json writes one JSON object on stdout, and is refused with -m,
+# which would write its map there too
+stats_json() {
+    "$LD8K" --stats=json -o "$OUT/st.out" "$OUT/relink_main.out" \
+        "$OUT/relink_lib.out" 2>/dev/null | python3 -c '
+import json, sys
+st = json.load(sys.stdin)
+assert st["relinked"] is False and st["segments"] and st["symbols"]' &&
+    ! "$LD8K" --stats=json -m -o "$OUT/st.out" "$OUT/relink_main.out" \
+        "$OUT/relink_lib.out" >/dev/null 2>&1
+}
+check stats_json stats_json
+
+# -r keeps the relocation items it writes in memory up to RLMAX (65536)
+# and spills the rest to an unnamed scratch file.  Either way the items
+# are the module's own, and nothing is left behind in the directory.
+# relbig_<n>.s has n sections of 25000 external references each.
+rel_items() {
+    python3 - "$@" <<'PY'
+import sys
+def items(f):
+    b = open(f, "rb").read()
+    n = b[2] << 8 | b[3]
+    init, rel = (int.from_bytes(b[i:i+4], "big") for i in (4, 8))
+    sg = [i for i in range(n) if int.from_bytes(b[18+4*i:20+4*i], "big")]
+    o = 16 + 4 * n + init
+    sym = o + rel
+    out = []
+    for i in range(o, o + rel, 6):
+        bas = b[i+4] << 8 | b[i+5]
+        out.append((sg.index(b[i]), b[i+1], b[i+2] << 8 | b[i+3],
+            b[sym+12*bas+4:sym+12*bas+12]))
+    return sorted(out)
+a, c = items(sys.argv[1]), items(sys.argv[2])
+sys.exit(not (a == c and len(a) == int(sys.argv[3])))
+PY
+}
+rel_spill() {
+    local n=$1 dir i
+    for ((i = 1; i <= n; i++)); do
+        printf '__text0%d\t.sect\n\t.repeat 100\n\t.repeat 250\n' $i
+        printf '\t.word\t_ext\n\t.endr\n\t.endr\n'
+    done | { printf '\t.global\t_ext\n'; cat; printf '\t.end\n'; } \
+        > "$OUT/relbig_$n.s"
+    assemble "$OUT/relbig_$n.s" "$OUT/relbig_$n.obj"
+    obj_to_xout "$OUT/relbig_$n.obj" "$OUT/relbig_$n.out" >/dev/null
+    dir=$(mktemp -d) || return 1
+    ( cd "$dir" && "$LD8K" -r -o r.out "$OUT/relbig_$n.out" >/dev/null 2>&1 ) &&
+    [ "$(ls -A "$dir")" = r.out ] &&
+    rel_items "$OUT/relbig_$n.out" "$dir/r.out" $((n * 25000))
+    local rc=$?
+    rm -rf "$dir"
+    return $rc
+}
+check rel_memory rel_spill 1
+check rel_spill rel_spill 3
+
+# -F bin of the run suite's programs, plain and -b, against xout2bin.py:
+# the run suite needs the emulator, this does not
+RUNDIR="$SUITEDIR/../run"
+assemble "$RUNDIR/crt0.s" "$OUT/crt0.obj"
+obj_to_xout "$OUT/crt0.obj" "$OUT/crt0.out" >/dev/null
+for src in "$RUNDIR"/test_*.c; do
+    name=$(basename "$src" .c)
+    compile_to_asm "$src" "$OUT/$name.s"
+    assemble "$OUT/$name.s" "$OUT/$name.obj"
+    obj_to_xout "$OUT/$name.obj" "$OUT/$name.out" >/dev/null
+    if [ ! -f "$OUT/$name.out" ] || [ ! -f "$OUT/crt0.out" ]; then
+        echo "FAIL bin_$name (no x.out)"
+        fail=$((fail+1))
+        continue
+    fi
+    check "bin_$name" same_bin "$OUT/$name.bin" -- "$OUT/crt0.out" "$OUT/$name.out"
+    check "bin_b_$name" same_bin "$OUT/$name.b.bin" -b -- "$OUT/crt0.out" "$OUT/$name.out"
+done
+
+echo ""
+echo "link: $pass passed, $fail failed, $skip skipped"
+print_summary
@@ -0,0 +1,9 @@
+; callees for segpos_main.s
+	.global _b
+	.global _c
+__text	.sect
+_b:
+	ret
+_c:
+	ret
+	.end
@@ -0,0 +1,14 @@
+; -b relaxes all three jumps, the last one right before __data, so
+; __data has to move down by 6 in the image as well as in the map
+	.global _a
+	.global _b
+	.global _c
+__text	.sect
+_a:
+	call _c
+	call _c
+	jp _b
+__data	.sect
+	.word _b
+	.word _c
+	.end
@@ -55,7 +55,6 @@ for src in "$SUITEDIR"/test_*.c; do
     out_s="$SUITEDIR/output/${name}.s"
     out_obj="$SUITEDIR/output/${name}.obj"
     out_xout="$SUITEDIR/output/${name}.out"
-    out_linked="$SUITEDIR/output/${name}.linked.out"
     out_bin="$SUITEDIR/output/${name}.bin"
 
     # Step 1: compile to assembly
@@ -82,23 +81,28 @@ for src in "$SUITEDIR"/test_*.c; do
         continue
     fi
 
-    # Step 4: link with crt0
-    link_errors=$(link_xout "$out_linked" "$CRT0_OUT" "$out_xout")
-    if [ ! -f "$out_linked" ]; then
+    # Step 4: link with crt0 into a flat binary
+    link_errors=$(link_bin "$out_bin" "$CRT0_OUT" "$out_xout")
+    if [ ! -s "$out_bin" ]; then
         echo "FAIL $name (link failed: $link_errors)"
         fail=$((fail+1))
         continue
     fi
 
-    # Step 5: convert to flat binary
-    conv_errors=$(xout_to_bin "$out_linked" "$out_bin")
-    if [ ! -f "$out_bin" ]; then
-        echo "FAIL $name (xout2bin failed: $conv_errors)"
+    # Step 4b: -F bin, plain and with -b, must be what xout2bin.py makes
+    # of the same link as an x.out
+    if ! same_bin "$out_bin" -- "$CRT0_OUT" "$out_xout"; then
+        echo "FAIL $name (-F bin differs from xout2bin.py)"
+        fail=$((fail+1))
+        continue
+    fi
+    if ! same_bin "$SUITEDIR/output/${name}.b.bin" -b -- "$CRT0_OUT" "$out_xout"; then
+        echo "FAIL $name (-b -F bin differs from xout2bin.py)"
         fail=$((fail+1))
         continue
     fi
 
-    # Step 6: run on emulator
+    # Step 5: run on emulator
     run_emu "$out_bin"
     emu_rc=$?
 
@@ -109,7 +113,7 @@ for src in "$SUITEDIR"/test_*.c; do
         continue
     fi
 
-    # Step 7: compare R0 with expected
+    # Step 6: compare R0 with expected
     if [ "$emu_r0" = "$expected" ]; then
         echo "PASS $name (R0=$emu_r0)"
         pass=$((pass+1))
@@ -1,13 +1,13 @@
 #!/bin/bash
 # Run Z8002 test suites
 # Usage: ./run_tests.sh [suite ...]
-#   No args → run all suites: codegen asm run
+#   No args → run all suites: cpp codegen asm link run
 #   ./run_tests.sh codegen       → run only codegen
 #   ./run_tests.sh codegen run   → run codegen and run
 
 TESTDIR="$(cd "$(dirname "$0")" && pwd)"
 
-ALL_SUITES="codegen asm run"
+ALL_SUITES="cpp codegen asm link run"
 
 if [ $# -gt 0 ]; then
     suites="$*"